@@ -1,6 +1,6 @@
 import esphome.codegen as cg
 import esphome.config_validation as cv
-from esphome import pins
+from esphome import automation, pins
 from esphome.components import spi
 from esphome.const import CONF_ID
 from esphome.core import CORE
@@ -21,6 +21,8 @@ Sx1276Driver = elero_ns.class_("Sx1276Driver", spi.SPIDevice)
 # New architecture: unified device registry
 DeviceRegistry = elero_ns.class_("DeviceRegistry")
 
+ApplySceneAction = elero_ns.class_("ApplySceneAction", automation.Action)
+
 CONF_GDO0_PIN = "gdo0_pin"
 CONF_IRQ_PIN = "irq_pin"
 CONF_ELERO_ID = "elero_id"
@@ -29,6 +31,14 @@ CONF_FREQ1 = "freq1"
 CONF_FREQ2 = "freq2"
 CONF_REGISTRY_ID = "registry_id"
 CONF_AUTO_STATS = "auto_stats"
+CONF_MAX_DEVICES = "max_devices"
+CONF_POLL_AIRTIME_BUDGET = "poll_airtime_budget"
+CONF_DUTY_CYCLE_LIMIT = "duty_cycle_limit"
+CONF_COMMAND_COALESCE_WINDOW = "command_coalesce_window"
+CONF_ACK_AWARE_REPEATS = "ack_aware_repeats"
+CONF_ADAPTIVE_REPEATS = "adaptive_repeats"
+CONF_LISTEN_BEFORE_TALK = "listen_before_talk"
+CONF_LBT_THRESHOLD = "lbt_threshold"
 CONF_RADIO = "radio"
 CONF_DRIVER_ID = "driver_id"
 CONF_BUSY_PIN = "busy_pin"
@@ -39,6 +49,10 @@ CONF_TCXO_VOLTAGE = "tcxo_voltage"
 CONF_FEM_PA_PIN = "fem_pa_pin"
 CONF_FEM_POWER_PIN = "fem_power_pin"
 CONF_FEM_ENABLE_PIN = "fem_enable_pin"
+CONF_COVERS = "covers"
+CONF_DST_ADDRESS = "dst_address"
+CONF_POSITION = "position"
+CONF_ACTION = "action"
 
 
 def _validate_irq_pin(config):
@@ -91,6 +105,27 @@ CONFIG_SCHEMA = cv.All(
             cv.Optional(CONF_FREQ1, default=0x71): cv.hex_int_range(min=0x0, max=0xFF),
             cv.Optional(CONF_FREQ2, default=0x21): cv.hex_int_range(min=0x0, max=0xFF),
             cv.Optional(CONF_AUTO_STATS, default=True): cv.boolean,
+            # Device slots (covers + lights + remotes). Slot ids are uint8_t.
+            cv.Optional(CONF_MAX_DEVICES, default=48): cv.int_range(min=1, max=254),
+            # Share of airtime status polls may use (hub-wide poll scheduler)
+            cv.Optional(CONF_POLL_AIRTIME_BUDGET, default="10%"): cv.All(
+                cv.percentage, cv.Range(min=0.01, max=1.0)
+            ),
+            # Regulatory duty cycle for our own TX (868.0–868.6 MHz: 1%)
+            cv.Optional(CONF_DUTY_CYCLE_LIMIT, default="1%"): cv.All(
+                cv.percentage, cv.Range(min=0.001, max=1.0)
+            ),
+            # Merge simultaneous cover commands into group packets (0ms = off)
+            cv.Optional(CONF_COMMAND_COALESCE_WINDOW, default="40ms"): cv.All(
+                cv.positive_time_period_milliseconds, cv.Range(max=cv.TimePeriod(milliseconds=500))
+            ),
+            # Stop a cover command's repeats once the cover's status confirms it
+            cv.Optional(CONF_ACK_AWARE_REPEATS, default=True): cv.boolean,
+            # Learn repeats, retry limit and retry backoff per device from link quality
+            cv.Optional(CONF_ADAPTIVE_REPEATS, default=True): cv.boolean,
+            # Sample channel RSSI before each packet and back off while it is busy
+            cv.Optional(CONF_LISTEN_BEFORE_TALK, default=True): cv.boolean,
+            cv.Optional(CONF_LBT_THRESHOLD, default=-90): cv.int_range(min=-120, max=-30),
             # SX1262-specific pins
             cv.Optional(CONF_BUSY_PIN): pins.gpio_input_pin_schema,
             cv.Optional(CONF_RST_PIN): pins.gpio_output_pin_schema,
@@ -186,11 +221,21 @@ async def to_code(config):
     cg.add(var.set_freq1(config[CONF_FREQ1]))
     cg.add(var.set_freq2(config[CONF_FREQ2]))
 
+    cg.add(var.set_lbt_enabled(config[CONF_LISTEN_BEFORE_TALK]))
+    cg.add(var.set_lbt_threshold(config[CONF_LBT_THRESHOLD]))
+
     cg.add(var.set_version(ELERO_VERSION))
 
-    # Create device registry and wire to hub
+    # Create device registry and wire to hub. Capacity is a compile-time
+    # constant — the registry's slot arrays are statically sized.
+    cg.add_build_flag(f"-DELERO_MAX_DEVICES={config[CONF_MAX_DEVICES]}")
     registry = cg.new_Pvariable(config[CONF_REGISTRY_ID])
     cg.add(registry.set_hub(var))
+    cg.add(registry.set_poll_airtime_budget(config[CONF_POLL_AIRTIME_BUDGET]))
+    cg.add(registry.set_duty_cycle_limit(config[CONF_DUTY_CYCLE_LIMIT]))
+    cg.add(registry.set_coalesce_window(config[CONF_COMMAND_COALESCE_WINDOW].total_milliseconds))
+    cg.add(registry.set_ack_aware_repeats(config[CONF_ACK_AWARE_REPEATS]))
+    cg.add(registry.set_adaptive_link(config[CONF_ADAPTIVE_REPEATS]))
     cg.add(var.set_registry(registry))
 
     # Auto-create internal diagnostic sensors for RF stats
@@ -208,11 +253,28 @@ async def to_code(config):
             ("tx_recover_total", "Elero TX Recover", "set_stats_tx_recover_sensor"),
             ("rx_packets_total", "Elero RX Packets", "set_stats_rx_packets_sensor"),
             ("rx_drops_total", "Elero RX Drops", "set_stats_rx_drops_sensor"),
+            ("rx_ring_high_water", "Elero RX Ring High Water", "set_stats_rx_high_water_sensor"),
             ("fifo_overflow_total", "Elero FIFO Overflows", "set_stats_fifo_overflows_sensor"),
             ("watchdog_recovery_total", "Elero Watchdog Recoveries", "set_stats_watchdog_sensor"),
             ("dispatch_latency_us", "Elero Dispatch Latency", "set_stats_dispatch_latency_sensor"),
             ("queue_transit_us", "Elero Queue Transit", "set_stats_queue_transit_sensor"),
             ("last_rx_age_ms", "Elero Last RX Age", "set_stats_last_rx_age_sensor"),
+            ("rf_task_wakes_total", "Elero RF Task Wakes", "set_stats_rf_task_wakes_sensor"),
+            ("rf_task_idle_pct", "Elero RF Task Idle", "set_stats_rf_task_idle_sensor"),
+            ("poll_rate_per_min", "Elero Poll Rate", "set_stats_poll_rate_sensor"),
+            ("poll_missed_total", "Elero Polls Unanswered", "set_stats_poll_missed_sensor"),
+            ("poll_passive_total", "Elero Passive Refreshes", "set_stats_poll_passive_sensor"),
+            ("rf_occupancy_pct", "Elero RF Occupancy", "set_stats_rf_occupancy_sensor"),
+            ("tx_delay_stop_ms", "Elero TX Delay STOP", "set_stats_tx_delay_stop_sensor"),
+            ("tx_delay_user_ms", "Elero TX Delay Commands", "set_stats_tx_delay_user_sensor"),
+            ("tx_delay_check_ms", "Elero TX Delay Follow-up CHECKs", "set_stats_tx_delay_check_sensor"),
+            ("tx_delay_poll_ms", "Elero TX Delay Polls", "set_stats_tx_delay_poll_sensor"),
+            ("lbt_clear_total", "Elero LBT Clear", "set_stats_lbt_clear_sensor"),
+            ("lbt_busy_total", "Elero LBT Busy", "set_stats_lbt_busy_sensor"),
+            ("lbt_forced_total", "Elero LBT Forced", "set_stats_lbt_forced_sensor"),
+            ("airtime_minute_ms", "Elero Airtime Last Minute", "set_stats_airtime_minute_sensor"),
+            ("airtime_hour_ms", "Elero Airtime Last Hour", "set_stats_airtime_hour_sensor"),
+            ("duty_cycle_remaining_pct", "Elero Duty Cycle Remaining", "set_stats_duty_cycle_remaining_sensor"),
         ]
         for sensor_id, name, setter in stats_sensors:
             sens_var_id = cv.declare_id(SensorClass)(f"elero_{sensor_id}")
@@ -222,3 +284,36 @@ async def to_code(config):
             cg.add(sens.set_accuracy_decimals(0))
             cg.add(getattr(var, setter)(sens))
             cg.add(cg.App.register_sensor(sens))
+
+
+_SCENE_COVER_SCHEMA = cv.All(
+    cv.Schema(
+        {
+            cv.Required(CONF_DST_ADDRESS): cv.hex_uint32_t,
+            cv.Optional(CONF_POSITION): cv.percentage,
+            cv.Optional(CONF_ACTION): cv.one_of("open", "close", "up", "down", "stop", "tilt", lower=True),
+        }
+    ),
+    cv.has_exactly_one_key(CONF_POSITION, CONF_ACTION),
+)
+
+
+@automation.register_action(
+    "elero.apply_scene",
+    ApplySceneAction,
+    cv.Schema(
+        {
+            cv.GenerateID(): cv.use_id(elero),
+            cv.Required(CONF_COVERS): cv.All(cv.ensure_list(_SCENE_COVER_SCHEMA), cv.Length(min=1)),
+        }
+    ),
+)
+async def apply_scene_to_code(config, action_id, template_arg, args):
+    var = cg.new_Pvariable(action_id, template_arg)
+    await cg.register_parented(var, config[CONF_ID])
+    for cover in config[CONF_COVERS]:
+        if CONF_POSITION in cover:
+            cg.add(var.add_position(cover[CONF_DST_ADDRESS], cover[CONF_POSITION]))
+        else:
+            cg.add(var.add_action(cover[CONF_DST_ADDRESS], cover[CONF_ACTION]))
+    return var
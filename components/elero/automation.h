@@ -0,0 +1,56 @@
+#pragma once
+
+/// @file automation.h
+/// @brief ESPHome actions of the elero hub.
+
+#include "elero.h"
+#include "device_registry.h"
+#include "elero_strings.h"
+#include "esphome/core/automation.h"
+#include "esphome/core/helpers.h"
+#include "esphome/core/log.h"
+#include <array>
+#include <vector>
+
+namespace esphome {
+namespace elero {
+
+/// `elero.apply_scene` — moves the listed covers as one scene
+/// (see DeviceRegistry::apply_scene). Covers are addressed by dst_address so
+/// YAML- and web-configured covers work alike.
+template<typename... Ts> class ApplySceneAction : public Action<Ts...>, public Parented<Elero> {
+ public:
+  void add_position(uint32_t dst_address, float position) {
+    this->covers_.push_back({dst_address, position, packet::command::INVALID});
+  }
+  void add_action(uint32_t dst_address, const char *action) {
+    this->covers_.push_back({dst_address, cover_sm::NO_TARGET, elero_action_to_command(action)});
+  }
+
+  void play(const Ts &...x) override {
+    auto *registry = this->parent_->get_registry();
+    if (registry == nullptr)
+      return;
+    std::array<SceneEntry, DeviceRegistry::MAX_DEVICES> entries{};
+    size_t n = 0;
+    for (const auto &c : this->covers_) {
+      if (n >= entries.size())
+        break;
+      entries[n++] = {registry->find(c.dst_address, DeviceType::COVER), c.position, c.command};
+    }
+    auto result = registry->apply_scene(std::span<const SceneEntry>(entries.data(), n));
+    ESP_LOGD("elero.scene", "Scene action: %u applied, %u skipped, done in ~%ums", result.applied, result.skipped,
+             result.completion_ms);
+  }
+
+ protected:
+  struct Cover {
+    uint32_t dst_address;
+    float position;
+    uint8_t command;
+  };
+  std::vector<Cover> covers_;
+};
+
+}  // namespace elero
+}  // namespace esphome
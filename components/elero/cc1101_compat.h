@@ -7,45 +7,143 @@
 /// The CC1101 hardware applies these automatically; the SX1262 must do them in software
 /// because its built-in CRC and whitening are incompatible (different polynomials).
 
+#include <array>
 #include <cstddef>
 #include <cstdint>
+#include <cstring>
 
 namespace esphome {
 namespace elero {
 
+// ─── CRC-16 ──────────────────────────────────────────────────────────────────
+
+namespace crc16 {
+
+constexpr uint16_t POLY = 0x8005;
+constexpr uint16_t INIT = 0xFFFF;
+
+constexpr std::array<uint16_t, 256> make_table() {
+  std::array<uint16_t, 256> table{};
+  for (int b = 0; b < 256; ++b) {
+    uint16_t crc = static_cast<uint16_t>(b << 8);
+    for (int bit = 0; bit < 8; ++bit)
+      crc = (crc & 0x8000) ? static_cast<uint16_t>((crc << 1) ^ POLY) : static_cast<uint16_t>(crc << 1);
+    table[b] = crc;
+  }
+  return table;
+}
+
+/// CRC of each possible top byte after 8 shifts (512 bytes of flash).
+inline constexpr std::array<uint16_t, 256> TABLE = make_table();
+
+}  // namespace crc16
+
 /// CC1101 CRC-16: polynomial 0x8005 (x^16 + x^15 + x^2 + 1), init 0xFFFF.
 /// Computed over data bytes BEFORE whitening. CC1101 auto-appends on TX;
-/// SX1262 must compute in software. MSB-first bit processing.
+/// SX1262 must compute in software. MSB-first, one table lookup per byte.
 inline uint16_t cc1101_crc16(const uint8_t *data, size_t len) {
-  uint16_t crc = 0xFFFF;
-  for (size_t i = 0; i < len; ++i) {
-    crc ^= static_cast<uint16_t>(data[i]) << 8;
-    for (int bit = 0; bit < 8; ++bit) {
-      if (crc & 0x8000) {
-        crc = (crc << 1) ^ 0x8005;
-      } else {
-        crc <<= 1;
-      }
-    }
-  }
+  uint16_t crc = crc16::INIT;
+  for (size_t i = 0; i < len; ++i)
+    crc = static_cast<uint16_t>((crc << 8) ^ crc16::TABLE[(crc >> 8) ^ data[i]]);
   return crc;
 }
 
+/// Verify a de-whitened frame [length | data... | CRC MSB | CRC LSB].
+/// @param frame_len 1 + length byte + 2
+inline bool cc1101_crc_ok(const uint8_t *frame, size_t frame_len) {
+  if (frame_len < 3)
+    return false;
+  size_t n = frame_len - 2;
+  uint16_t rx_crc = (static_cast<uint16_t>(frame[n]) << 8) | frame[n + 1];
+  return cc1101_crc16(frame, n) == rx_crc;
+}
+
+// ─── IBM PN9 whitening ───────────────────────────────────────────────────────
+// Polynomial x^9 + x^5 + 1, seed 0x1FF, right-shifting LFSR. The seed never
+// changes, so the keystream is a constant: the first KEYSTREAM_LEN bytes are
+// generated at compile time and applied 32 bits at a time. Longer buffers
+// (never produced by Elero frames) continue with the LFSR past the table.
+
+namespace pn9 {
+
+constexpr uint16_t SEED = 0x1FF;
+constexpr size_t KEYSTREAM_LEN = 64;  ///< Covers the largest CC1101 FIFO frame
+
+/// Advance the LFSR by one byte (8 bits). The low 8 bits of the state are
+/// the keystream byte for the current position.
+constexpr uint16_t next_key(uint16_t key) {
+  for (int j = 0; j < 8; ++j) {
+    uint16_t msb = ((key >> 5) ^ (key >> 0)) & 1;
+    key = (key >> 1) | (msb << 8);
+  }
+  return key;
+}
+
+constexpr std::array<uint8_t, KEYSTREAM_LEN> make_keystream() {
+  std::array<uint8_t, KEYSTREAM_LEN> ks{};
+  uint16_t key = SEED;
+  for (size_t i = 0; i < KEYSTREAM_LEN; ++i) {
+    ks[i] = static_cast<uint8_t>(key & 0xFF);
+    key = next_key(key);
+  }
+  return ks;
+}
+
+constexpr uint16_t make_key_after_table() {
+  uint16_t key = SEED;
+  for (size_t i = 0; i < KEYSTREAM_LEN; ++i)
+    key = next_key(key);
+  return key;
+}
+
+/// PN9 keystream bytes 0..63 (FF E1 1D 9A ED 85 33 24 ...).
+alignas(4) inline constexpr std::array<uint8_t, KEYSTREAM_LEN> KEYSTREAM = make_keystream();
+
+/// LFSR state for keystream byte KEYSTREAM_LEN.
+inline constexpr uint16_t KEY_AFTER_TABLE = make_key_after_table();
+
+static_assert(KEYSTREAM[0] == 0xFF && KEYSTREAM[1] == 0xE1 && KEYSTREAM[7] == 0x24,
+              "PN9 keystream must match the CC1101 sequence");
+
+}  // namespace pn9
+
+/// Apply the PN9 keystream starting at keystream position @p offset to
+/// @p data[0..len). Lets a receiver de-whiten the length byte first and the
+/// rest of the frame only once the length looks plausible.
+inline void cc1101_pn9_whiten_from(uint8_t *data, size_t len, size_t offset) {
+  const uint8_t *ks = pn9::KEYSTREAM.data();
+  size_t table_len = 0;
+  if (offset < pn9::KEYSTREAM_LEN)
+    table_len = len < pn9::KEYSTREAM_LEN - offset ? len : pn9::KEYSTREAM_LEN - offset;
+
+  size_t i = 0;
+  for (; i + 4 <= table_len; i += 4) {
+    uint32_t d, k;
+    memcpy(&d, data + i, 4);
+    memcpy(&k, ks + offset + i, 4);
+    d ^= k;
+    memcpy(data + i, &d, 4);
+  }
+  for (; i < table_len; ++i)
+    data[i] ^= ks[offset + i];
+  if (i == len)
+    return;
+
+  // Past the precomputed table: continue the LFSR
+  uint16_t key = pn9::KEY_AFTER_TABLE;
+  for (size_t pos = pn9::KEYSTREAM_LEN; pos < offset + i; ++pos)
+    key = pn9::next_key(key);
+  for (; i < len; ++i) {
+    data[i] ^= key & 0xFF;
+    key = pn9::next_key(key);
+  }
+}
+
 /// CC1101 IBM PN9 whitening/de-whitening (XOR is self-inverse).
-/// Polynomial x^9 + x^5 + 1, seed 0x1FF, right-shifting LFSR.
 /// Applied to [length + data + CRC] after sync word. The CC1101 does this
 /// in hardware; the SX1262 must apply it in software since its built-in
 /// whitening uses an incompatible scrambler (NOT IBM PN9).
-inline void cc1101_pn9_whiten(uint8_t *data, size_t len) {
-  uint16_t key = 0x1FF;
-  for (size_t i = 0; i < len; ++i) {
-    data[i] ^= key & 0xFF;
-    for (int j = 0; j < 8; ++j) {
-      uint16_t msb = ((key >> 5) ^ (key >> 0)) & 1;
-      key = (key >> 1) | (msb << 8);
-    }
-  }
-}
+inline void cc1101_pn9_whiten(uint8_t *data, size_t len) { cc1101_pn9_whiten_from(data, len, 0); }
 
 }  // namespace elero
 }  // namespace esphome
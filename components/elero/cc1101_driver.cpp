@@ -12,6 +12,12 @@ namespace elero {
 
 static const char *const TAG = "elero.cc1101";
 
+/// CC1101_RSSI register → dBm: two's complement in 0.5 dB steps plus the offset
+/// (integer counterpart of packet::calc_rssi()).
+static int16_t rssi_raw_to_dbm(uint8_t raw) {
+  return static_cast<int16_t>(static_cast<int8_t>(raw) / 2 + packet::RSSI_OFFSET);
+}
+
 // ─── SpiTransaction RAII Implementation ───────────────────────────────────
 SpiTransaction::SpiTransaction(CC1101Driver *driver) : driver_(driver) {
   driver_->enable();
@@ -104,6 +110,13 @@ bool CC1101Driver::has_data() {
   return this->rx_ready_ != nullptr && this->rx_ready_->load(std::memory_order_acquire);
 }
 
+bool CC1101Driver::sample_rssi(int16_t &dbm) {
+  if (this->RadioDriver::mode_ != RadioMode::RX) return false;
+  uint8_t raw = this->read_status(CC1101_RSSI);
+  dbm = rssi_raw_to_dbm(raw);
+  return true;
+}
+
 size_t CC1101Driver::read_fifo(uint8_t *buf, size_t max_len) {
   uint8_t len = this->read_status_reliable_(CC1101_RXBYTES);
 
@@ -145,7 +158,7 @@ RadioHealth CC1101Driver::check_health() {
 
   // Log RSSI for TX hardware test (read CC1101 RSSI register in RX mode)
   uint8_t rssi_raw = this->read_status(CC1101_RSSI);
-  int16_t rssi_dbm = (rssi_raw >= 128) ? ((rssi_raw - 256) / 2 - 74) : (rssi_raw / 2 - 74);
+  int16_t rssi_dbm = rssi_raw_to_dbm(rssi_raw);
   ESP_LOGW(TAG, "health: MARCSTATE=0x%02x RSSI=%d dBm (raw=0x%02x)", marc, rssi_dbm, rssi_raw);
 
   // RX is the expected idle state
@@ -68,6 +68,7 @@ class CC1101Driver : public RadioDriver,
 
   bool has_data() override;
   size_t read_fifo(uint8_t *buf, size_t max_len) override;
+  bool sample_rssi(int16_t &dbm) override;
 
   RadioHealth check_health() override;
   void recover() override;
@@ -75,6 +76,7 @@ class CC1101Driver : public RadioDriver,
   void set_frequency_regs(uint8_t f2, uint8_t f1, uint8_t f0) override;
   void dump_config() override;
   const char *radio_name() const override { return "cc1101"; }
+  uint32_t bitrate_bps() const override { return 76766; }  // MDMCFG4/3 = 0x7B/0x83 at 26 MHz
   int rx_sensitivity_dbm() const override { return -104; }
 
   // ── Configuration setters ──────────────────────────────────────────────────
@@ -1,6 +1,7 @@
 #pragma once
 
 #include "elero_packet.h"
+#include "link_quality.h"
 #include "time_provider.h"
 #include "tx_client.h"
 #include "esphome/core/log.h"
@@ -11,9 +12,17 @@ namespace elero {
 
 /// Non-blocking command queue and transmission logic for Elero cover and light components.
 ///
-/// All commands are sent as 0x44 button packets (3x with 10ms gaps), matching
-/// how physical Elero remotes transmit. The hub's build_tx_packet_() uses
-/// the command template's type field to select the packet builder.
+/// Movement and light commands are sent as 0x44 button packets with 10ms gaps,
+/// matching how physical Elero remotes transmit; STOP and CHECK go out as
+/// targeted 0x6A command packets (enqueue()'s type). The hub's
+/// build_tx_packet_() uses the command template's type field to select the
+/// packet builder. The repeats of one command go out as a single RF task burst
+/// (see tx_burst.h) when the hub supports it.
+///
+/// Commands enqueued with LINK_REPEATS take their repeat count from the
+/// sender's LinkQuality (see link_quality.h), which learns it from the link to
+/// its device — 3 until the link is known. Retry limit and retry backoff of
+/// single-device commands come from there too.
 ///
 /// State machine:
 ///   IDLE ──enqueue()──▶ WAIT_DELAY ──request_tx()──▶ TX_PENDING
@@ -28,6 +37,8 @@ class CommandSender : public TxClient {
   };
 
   static constexpr uint32_t TX_PENDING_TIMEOUT_MS = packet::timing::TX_PENDING_TIMEOUT;
+  /// enqueue() packet count: the repeat count learned for this device's link.
+  static constexpr uint8_t LINK_REPEATS = 0;
 
   CommandSender() = default;
 
@@ -54,6 +65,13 @@ class CommandSender : public TxClient {
           return;
         }
 
+        // The learned repeat count may have dropped to or below the packets
+        // of this command already sent: it is complete, nothing left to post.
+        if (this->send_packets_ >= this->target_packets_()) {
+          this->advance_queue_();
+          return;
+        }
+
         {
           const auto &entry = this->command_queue_.front();
           this->command_.payload[4] = entry.cmd;
@@ -67,12 +85,12 @@ class CommandSender : public TxClient {
           }
         }
 
-        if (parent->request_tx(this, this->command_)) {
+        if (this->request_tx_(parent)) {
           this->state_ = State::TX_PENDING;
           this->tx_start_time_ = now;
           ESP_LOGV(tag, "TX started for 0x%06x cmd=0x%02x, packet %d/%d",
                    this->command_.dst_addr, this->command_.payload[4],
-                   this->send_packets_ + 1, this->command_queue_.front().packets);
+                   this->send_packets_ + 1, this->target_packets_());
         } else {
           ESP_LOGVV(tag, "Radio busy for 0x%06x, will retry", this->command_.dst_addr);
         }
@@ -83,7 +101,8 @@ class CommandSender : public TxClient {
           ESP_LOGW(tag, "TX_PENDING timeout for 0x%06x after %ums, treating as failure",
                    this->command_.dst_addr, TX_PENDING_TIMEOUT_MS);
           ++this->send_retries_;
-          if (this->send_retries_ > packet::limits::SEND_RETRIES) {
+          ++this->command_retries_;
+          if (this->send_retries_ > this->link_params_().max_retries) {
             ESP_LOGE(tag, "Max retries for 0x%06x after timeout, dropping command 0x%02x",
                      this->command_.dst_addr, this->command_.payload[4]);
             this->advance_queue_();
@@ -98,53 +117,41 @@ class CommandSender : public TxClient {
   }
 
   void on_tx_complete(bool success) override {
-    if (this->state_ != State::TX_PENDING) {
-      ESP_LOGD(this->log_tag_, "Ignoring stale on_tx_complete for 0x%06x (state=%d, success=%d)",
-               this->command_.dst_addr, static_cast<int>(this->state_), success);
+    if (!this->accept_completion_(success))
       return;
-    }
-
-    if (this->cancelled_) {
-      ESP_LOGD(this->log_tag_, "TX for 0x%06x completed but was cancelled, ignoring",
-               this->command_.dst_addr);
-      this->cancelled_ = false;
-      this->send_packets_ = 0;
-      this->send_retries_ = 0;
-      this->state_ = State::IDLE;
+    if (this->acked_) {
+      this->finish_acked_();
       return;
     }
 
-    this->last_tx_time_ = get_time_provider().millis();
-
     if (success) {
       this->send_retries_ = 0;
       ++this->send_packets_;
+      this->after_packets_sent_();
+    } else {
+      this->on_tx_failed_();
+    }
+  }
 
-      uint8_t target_packets = this->command_queue_.empty()
-          ? packet::button::PACKETS
-          : this->command_queue_.front().packets;
-      if (this->send_packets_ >= target_packets) {
-        ESP_LOGV(this->log_tag_, "Command 0x%02x to 0x%06x complete (%d packets)",
-                 this->command_.payload[4], this->command_.dst_addr, this->send_packets_);
-        this->advance_queue_();
-      } else {
-        this->state_ = State::WAIT_DELAY;
-      }
+  void on_tx_burst_complete(const TxBurstReport &report) override {
+    if (!this->accept_completion_(report.all_ok()))
+      return;
+    if (this->acked_) {
+      this->send_packets_ += report.sent_ok();
+      this->finish_acked_();
+      return;
+    }
+
+    // Packets that made it count even if others in the burst failed;
+    // a retry only resends the remainder.
+    this->send_packets_ += report.sent_ok();
+    if (report.all_ok()) {
+      this->send_retries_ = 0;
+      this->after_packets_sent_();
     } else {
-      ++this->send_retries_;
-      ESP_LOGD(this->log_tag_, "TX retry %d/%d for 0x%06x",
-               this->send_retries_, packet::limits::SEND_RETRIES, this->command_.dst_addr);
-
-      if (this->send_retries_ > packet::limits::SEND_RETRIES) {
-        ESP_LOGE(this->log_tag_, "Max retries for 0x%06x, dropping command 0x%02x",
-                 this->command_.dst_addr, this->command_.payload[4]);
-        this->advance_queue_();
-      } else {
-        uint32_t backoff_ms = this->calculate_backoff_ms_();
-        ESP_LOGD(this->log_tag_, "Backoff %ums before retry", backoff_ms);
-        this->last_tx_time_ = get_time_provider().millis() + backoff_ms - packet::button::INTER_PACKET_MS;
-        this->state_ = State::WAIT_DELAY;
-      }
+      ESP_LOGD(this->log_tag_, "Burst to 0x%06x: %d/%d packets sent",
+               this->command_.dst_addr, report.sent_ok(), report.packets);
+      this->on_tx_failed_();
     }
   }
 
@@ -154,11 +161,12 @@ class CommandSender : public TxClient {
   ///   - Lights: enqueue(UP/DOWN) + enqueue(RELEASE) to stop dimming
   /// Consecutive duplicate commands (same cmd + type) are collapsed.
   /// @param cmd_byte The command byte to send
-  /// @param packets Number of RF packets (default: 3 for button protocol)
+  /// @param packets Number of RF packets (default: the learned repeat count,
+  ///        3 for button protocol until the link is known)
   /// @param type Packet type: BUTTON (0x44) or COMMAND (0x6a)
   /// @return true if queued successfully, false if queue is full
   [[nodiscard]] bool enqueue(uint8_t cmd_byte,
-                             uint8_t packets = packet::button::PACKETS,
+                             uint8_t packets = LINK_REPEATS,
                              uint8_t type = packet::msg_type::BUTTON) {
     // Collapse consecutive duplicates (same cmd AND type)
     if (!this->command_queue_.empty() &&
@@ -182,7 +190,9 @@ class CommandSender : public TxClient {
     this->command_queue_ = std::queue<QueueEntry>{};
     this->send_packets_ = 0;
     this->send_retries_ = 0;
+    this->command_retries_ = 0;
     this->last_tx_time_ = 0;
+    this->acked_ = false;
 
     if (this->state_ == State::TX_PENDING) {
       // Cancelled TX won't call advance_queue_, so bump the counter now
@@ -194,26 +204,179 @@ class CommandSender : public TxClient {
     }
   }
 
+  /// The target's status @p state_byte confirms the command being sent (or
+  /// just sent): its remaining repeats and a CHECK queued right behind it are
+  /// redundant and dropped. Returns true if a TX is still pending — the rest
+  /// is skipped when it completes, and the hub may cut its burst short.
+  bool on_acknowledged(uint8_t state_byte) {
+    if (this->state_ == State::IDLE || this->cancelled_ ||
+        !packet::status_acknowledges(this->command_.payload[4], state_byte))
+      return false;
+    if (this->state_ == State::TX_PENDING) {
+      this->acked_ = true;
+      return true;
+    }
+    // WAIT_DELAY: between per-packet repeats, or already done with it
+    if (this->send_packets_ > 0)
+      this->advance_queue_();
+    this->drop_followup_check_();
+    return false;
+  }
+
+  /// A hub-side TX scheduler withdrew the pending request before it aired, to
+  /// let a newer command go first: drop that command without counting a
+  /// failure and continue with the rest of the queue.
+  void skip_pending() {
+    if (this->state_ != State::TX_PENDING || this->cancelled_)
+      return;
+    if (!this->command_queue_.empty())
+      this->command_queue_.pop();
+    if (this->send_packets_ > 0)
+      this->increase_counter_();  // Earlier repeats of it did air
+    this->send_packets_ = 0;
+    this->send_retries_ = 0;
+    this->command_retries_ = 0;
+    this->acked_ = false;
+    this->command_.num_dests = 0;
+    this->state_ = this->command_queue_.empty() ? State::IDLE : State::WAIT_DELAY;
+  }
+
+  /// A hub-side TX scheduler is still holding the pending request, or just
+  /// handed it to the radio: the TX_PENDING timeout counts from the hand-off.
+  void restart_tx_timeout(uint32_t now) {
+    if (this->state_ == State::TX_PENDING)
+      this->tx_start_time_ = now;
+  }
+
   State state() const { return this->state_; }
   bool is_busy() const { return this->state_ != State::IDLE || !this->command_queue_.empty(); }
   bool has_pending_commands() const { return !this->command_queue_.empty(); }
   size_t queue_size() const { return this->command_queue_.size(); }
   EleroCommand &command() { return this->command_; }
   const EleroCommand &command() const { return this->command_; }
+  LinkQuality &link() { return this->link_; }
+  const LinkQuality &link() const { return this->link_; }
+  /// Retry backoff after the first failed attempt, at the current link parameters.
+  uint32_t base_backoff_ms() const { return this->backoff_ms_(1); }
 
  private:
-  uint32_t calculate_backoff_ms_() const {
-    uint8_t shift = (this->send_retries_ < 4) ? this->send_retries_ : 3;
+  /// Hubs that can repeat packets on the RF task (Elero::request_tx_burst)
+  /// get the remaining packets of the current command in one request, so the
+  /// inter-packet gap no longer depends on main loop scheduling. Hubs without
+  /// it (test doubles) get one request_tx() per packet.
+  template<typename Hub> bool request_tx_(Hub *parent) {
+    if constexpr (requires { parent->request_tx_burst(this, this->command_, uint8_t{}, uint8_t{}); }) {
+      uint8_t remaining = this->target_packets_() - this->send_packets_;
+      return parent->request_tx_burst(this, this->command_, remaining,
+                                      static_cast<uint8_t>(packet::button::INTER_PACKET_MS));
+    } else {
+      return parent->request_tx(this, this->command_);
+    }
+  }
+
+  uint8_t target_packets_() const {
+    uint8_t packets = this->command_queue_.empty() ? LINK_REPEATS : this->command_queue_.front().packets;
+    return packets == LINK_REPEATS ? this->link_params_().repeats : packets;
+  }
+
+  /// A group press also reaches receivers whose links the lead's LinkQuality
+  /// knows nothing about: it uses the default repeats, retries and backoff.
+  const LinkParams &link_params_() const {
+    static constexpr LinkParams GROUP_PARAMS{};
+    return this->command_.num_dests > 1 ? GROUP_PARAMS : this->link_.params();
+  }
+
+  /// Common guard for on_tx_complete()/on_tx_burst_complete().
+  /// Returns false if the completion is stale or the TX was cancelled.
+  bool accept_completion_([[maybe_unused]] bool success) {
+    if (this->state_ != State::TX_PENDING) {
+      ESP_LOGD(this->log_tag_, "Ignoring stale on_tx_complete for 0x%06x (state=%d, success=%d)",
+               this->command_.dst_addr, static_cast<int>(this->state_), success);
+      return false;
+    }
+
+    if (this->cancelled_) {
+      ESP_LOGD(this->log_tag_, "TX for 0x%06x completed but was cancelled, ignoring",
+               this->command_.dst_addr);
+      this->cancelled_ = false;
+      this->send_packets_ = 0;
+      this->send_retries_ = 0;
+      this->state_ = State::IDLE;
+      return false;
+    }
+
+    this->last_tx_time_ = get_time_provider().millis();
+    return true;
+  }
+
+  void after_packets_sent_() {
+    if (this->send_packets_ >= this->target_packets_()) {
+      ESP_LOGV(this->log_tag_, "Command 0x%02x to 0x%06x complete (%d packets)",
+               this->command_.payload[4], this->command_.dst_addr, this->send_packets_);
+      this->advance_queue_();
+    } else {
+      this->state_ = State::WAIT_DELAY;
+    }
+  }
+
+  void on_tx_failed_() {
+    ++this->send_retries_;
+    ++this->command_retries_;
+    uint8_t max_retries = this->link_params_().max_retries;
+    ESP_LOGD(this->log_tag_, "TX retry %d/%d for 0x%06x",
+             this->send_retries_, max_retries, this->command_.dst_addr);
+
+    if (this->send_retries_ > max_retries) {
+      ESP_LOGE(this->log_tag_, "Max retries for 0x%06x, dropping command 0x%02x",
+               this->command_.dst_addr, this->command_.payload[4]);
+      this->advance_queue_();
+    } else {
+      uint32_t backoff_ms = this->calculate_backoff_ms_();
+      ESP_LOGD(this->log_tag_, "Backoff %ums before retry", backoff_ms);
+      this->last_tx_time_ = get_time_provider().millis() + backoff_ms - packet::button::INTER_PACKET_MS;
+      this->state_ = State::WAIT_DELAY;
+    }
+  }
+
+  uint32_t calculate_backoff_ms_() const { return this->backoff_ms_(this->send_retries_); }
+
+  /// Weak links back off longer: interference that ate one attempt tends
+  /// to eat an immediate retry too.
+  uint32_t backoff_ms_(uint8_t retries) const {
+    uint8_t shift = ((retries < 4) ? retries : 3) + this->link_params_().backoff_shift;
     uint32_t backoff_ms = packet::button::INTER_PACKET_MS << shift;
     return (backoff_ms > packet::timing::MAX_BACKOFF_MS) ? packet::timing::MAX_BACKOFF_MS : backoff_ms;
   }
 
+  void finish_acked_() {
+    ESP_LOGV(this->log_tag_, "0x%06x acknowledged cmd 0x%02x after %d packets", this->command_.dst_addr,
+             this->command_.payload[4], this->send_packets_);
+    this->acked_ = false;
+    this->advance_queue_();
+    this->drop_followup_check_();
+  }
+
+  /// Drop a not-yet-sent CHECK at the front — the status just received answers it.
+  void drop_followup_check_() {
+    if (this->command_queue_.empty() || this->send_packets_ != 0)
+      return;
+    const auto &front = this->command_queue_.front();
+    if (front.cmd != packet::command::CHECK || front.type != packet::msg_type::COMMAND)
+      return;
+    this->command_queue_.pop();
+    if (this->command_queue_.empty())
+      this->state_ = State::IDLE;
+  }
+
   void advance_queue_() {
     if (!this->command_queue_.empty()) {
       this->command_queue_.pop();
     }
+    if (this->command_.num_dests <= 1)
+      this->link_.on_command_done(this->command_retries_);  // A group's outcome is not the lead's link
     this->send_packets_ = 0;
     this->send_retries_ = 0;
+    this->command_retries_ = 0;
     this->command_.num_dests = 0;  // Clear group fields after each command drains
     this->increase_counter_();
     this->state_ = this->command_queue_.empty() ? State::IDLE : State::WAIT_DELAY;
@@ -237,8 +400,11 @@ class CommandSender : public TxClient {
   uint32_t tx_start_time_{0};
   uint8_t send_packets_{0};
   uint8_t send_retries_{0};
+  uint8_t command_retries_{0};  ///< Failed attempts of the current command, for link_
   bool cancelled_{false};
+  bool acked_{false};  ///< Target acknowledged the pending TX (see on_acknowledged())
   const char *log_tag_{"sender"};
+  LinkQuality link_;
 };
 
 }  // namespace elero
@@ -5,6 +5,7 @@
 #include "overloaded.h"
 #include "elero_packet.h"
 #include <algorithm>
+#include <cmath>
 
 namespace esphome::elero::cover_sm {
 
@@ -55,6 +56,38 @@ bool is_idle(const State &state) {
            std::holds_alternative<Stopping>(state);
 }
 
+bool tick_deadline(const State &state, const Context &ctx, uint32_t &at) {
+    return std::visit(overloaded{
+        [](const Idle &) { return false; },
+        [&](const Opening &s) { at = s.start_ms + ctx.movement_timeout_ms; return true; },
+        [&](const Closing &s) { at = s.start_ms + ctx.movement_timeout_ms; return true; },
+        [&](const Stopping &s) { at = s.stop_ms + ctx.post_stop_cooldown_ms; return true; },
+    }, state);
+}
+
+/// Time to travel @p distance at full-travel duration @p dur, rounded up.
+static uint32_t travel_ms(float distance, uint32_t dur) {
+    if (distance <= 0.0f) return 0;
+    return static_cast<uint32_t>(std::ceil(distance * static_cast<float>(dur)));
+}
+
+bool reach_time(const State &state, float target, const Context &ctx, uint32_t &at) {
+    return std::visit(overloaded{
+        [](const Idle &) { return false; },
+        [](const Stopping &) { return false; },
+        [&](const Opening &s) {
+            if (ctx.open_duration_ms == 0) return false;
+            at = s.start_ms + travel_ms(target - s.start_position, ctx.open_duration_ms);
+            return true;
+        },
+        [&](const Closing &s) {
+            if (ctx.close_duration_ms == 0) return false;
+            at = s.start_ms + travel_ms(s.start_position - target, ctx.close_duration_ms);
+            return true;
+        },
+    }, state);
+}
+
 Operation operation(const State &state) {
     return std::visit(overloaded{
         [](const Idle &) { return Operation::IDLE; },
@@ -79,6 +79,15 @@ bool is_moving(const State &state);
 /// Whether the cover is in a stable state (Idle or Stopping).
 bool is_idle(const State &state);
 
+/// Next time on_tick() can change the state: movement timeout while moving,
+/// cooldown end while Stopping.
+/// @return false if the state has no timed transition (Idle)
+bool tick_deadline(const State &state, const Context &ctx, uint32_t &at);
+
+/// When a moving cover's derived position reaches @p target.
+/// @return false if not moving or the direction has no duration
+bool reach_time(const State &state, float target, const Context &ctx, uint32_t &at);
+
 /// ESPHome-compatible operation enum.
 enum class Operation : uint8_t { IDLE = 0, OPENING = 1, CLOSING = 2 };
 
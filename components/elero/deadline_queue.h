@@ -0,0 +1,136 @@
+/// @file deadline_queue.h
+/// @brief Indexed min-heap of per-slot wake deadlines for DeviceRegistry::loop().
+///
+/// Each registry slot has at most one pending deadline (millis()). loop() pops
+/// only the slots that are due and reschedules them, so an idle fleet costs
+/// O(due devices) per iteration instead of a full scan. Fixed-size, no heap.
+///
+/// Deadlines compare with wrap-around arithmetic (like every millis() check in
+/// this component), so all pending deadlines must lie within ±24 days of each
+/// other — poll intervals and timeouts are minutes at most.
+
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+namespace esphome::elero {
+
+/// Earliest of several candidate deadlines (wrap-safe).
+struct EarliestDeadline {
+    bool set{false};
+    uint32_t ms{0};
+
+    void consider(uint32_t at) {
+        if (!set || static_cast<int32_t>(at - ms) < 0) {
+            ms = at;
+            set = true;
+        }
+    }
+};
+
+template<size_t N>
+class DeadlineQueue {
+    static_assert(N > 0 && N < 0xFF, "ids must fit in uint8_t (0xFF = not queued)");
+
+ public:
+    static constexpr uint8_t NONE = 0xFF;
+
+    DeadlineQueue() { pos_.fill(NONE); }
+
+    /// Set (or move) the deadline of @p id.
+    void schedule(uint8_t id, uint32_t at) {
+        if (id >= N) return;
+        at_[id] = at;
+        if (pos_[id] == NONE) {
+            heap_[size_] = id;
+            pos_[id] = static_cast<uint8_t>(size_);
+            ++size_;
+            sift_up_(pos_[id]);
+        } else {
+            sift_up_(pos_[id]);
+            sift_down_(pos_[id]);
+        }
+    }
+
+    /// Move @p id's deadline earlier only (or queue it if absent).
+    void schedule_earlier(uint8_t id, uint32_t at) {
+        if (id >= N) return;
+        if (pos_[id] == NONE || before_(at, at_[id])) schedule(id, at);
+    }
+
+    void cancel(uint8_t id) {
+        if (id >= N || pos_[id] == NONE) return;
+        size_t i = pos_[id];
+        --size_;
+        if (i != size_) {
+            place_(i, heap_[size_]);
+            sift_up_(i);
+            sift_down_(pos_[heap_[i]]);
+        }
+        pos_[id] = NONE;
+    }
+
+    [[nodiscard]] bool contains(uint8_t id) const { return id < N && pos_[id] != NONE; }
+    [[nodiscard]] bool empty() const { return size_ == 0; }
+    [[nodiscard]] size_t size() const { return size_; }
+
+    /// Earliest pending deadline. Returns false if nothing is queued.
+    [[nodiscard]] bool next_deadline(uint32_t &at) const {
+        if (size_ == 0) return false;
+        at = at_[heap_[0]];
+        return true;
+    }
+
+    /// Remove every id whose deadline is ≤ @p now and write it to @p out
+    /// (room for N ids). Returns the number written.
+    size_t pop_due(uint32_t now, uint8_t *out) {
+        size_t n = 0;
+        while (size_ > 0 && !before_(now, at_[heap_[0]])) {
+            uint8_t id = heap_[0];
+            out[n++] = id;
+            cancel(id);
+        }
+        return n;
+    }
+
+ private:
+    static bool before_(uint32_t a, uint32_t b) { return static_cast<int32_t>(a - b) < 0; }
+
+    void place_(size_t i, uint8_t id) {
+        heap_[i] = id;
+        pos_[id] = static_cast<uint8_t>(i);
+    }
+
+    void sift_up_(size_t i) {
+        uint8_t id = heap_[i];
+        while (i > 0) {
+            size_t parent = (i - 1) / 2;
+            if (!before_(at_[id], at_[heap_[parent]])) break;
+            place_(i, heap_[parent]);
+            i = parent;
+        }
+        place_(i, id);
+    }
+
+    void sift_down_(size_t i) {
+        uint8_t id = heap_[i];
+        while (true) {
+            size_t child = 2 * i + 1;
+            if (child >= size_) break;
+            if (child + 1 < size_ && before_(at_[heap_[child + 1]], at_[heap_[child]])) ++child;
+            if (!before_(at_[heap_[child]], at_[id])) break;
+            place_(i, heap_[child]);
+            i = child;
+        }
+        place_(i, id);
+    }
+
+    std::array<uint8_t, N> heap_{};   ///< Min-heap of ids by at_
+    std::array<uint8_t, N> pos_{};    ///< id → heap position, NONE if not queued
+    std::array<uint32_t, N> at_{};    ///< id → deadline
+    size_t size_{0};
+};
+
+}  // namespace esphome::elero
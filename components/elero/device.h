@@ -2,13 +2,18 @@
 /// @brief Unified Device struct — one model for all device types and all output modes.
 ///
 /// A Device composes:
-///   NvsDeviceConfig (persistence format, used directly as config)
+///   NvsDeviceConfig (persistence format, used directly as config — stored cold, see below)
 ///   + RfMeta (shared RF metadata)
 ///   + CommandSender (shared TX queue — covers/lights use it, remotes don't)
 ///   + variant<CoverDevice, LightDevice, RemoteDevice> (type-specific state)
 ///
 /// CommandSender lives OUTSIDE the variant because TxClient (its base) is
 /// non-movable (hub holds pointer during TX). The variant must be movable.
+///
+/// Hot/cold layout: DeviceRegistry keeps the configs (names, addressing,
+/// persistence metadata) in a separate array; Device only references its
+/// entry. Everything the registry loop needs per iteration — enabled flag,
+/// state machine contexts, poll timer, sender — is in the Device itself.
 
 #pragma once
 
@@ -58,6 +63,7 @@ inline constexpr const char *command_source_str(CommandSource src) {
 
 struct CoverDevice {
     cover_sm::State state{cover_sm::Idle{}}; ///< Default Idle{0.5} = unknown at boot
+    cover_sm::Context ctx;                   ///< From config; refreshed by init_device/update_device_config
     PollTimer       poll;
     float           target_position{cover_sm::NO_TARGET};  ///< NO_TARGET = no target, 0..1 = intermediate target
     cover_sm::Operation last_direction{cover_sm::Operation::OPENING};  ///< For toggle logic
@@ -81,6 +87,7 @@ struct CoverDevice {
 
 struct LightDevice {
     light_sm::State state{light_sm::Off{}};
+    light_sm::Context ctx;                   ///< From config; refreshed by init_device/update_device_config
     CommandSource   last_command_source{CommandSource::UNKNOWN};
 
     /// Last-published state cache. Registry diffs against this to detect changes.
@@ -120,8 +127,11 @@ using DeviceLogic = std::variant<CoverDevice, LightDevice, RemoteDevice>;
 // ═══════════════════════════════════════════════════════════════════════════════
 
 struct Device {
+    explicit Device(NvsDeviceConfig &cfg) : config(cfg) {}
+
     bool            active{false};       ///< false = empty slot
-    NvsDeviceConfig config;              ///< Persistence format, used directly
+    bool            enabled{false};      ///< Mirrors config.is_enabled() (hot copy for the loop)
+    NvsDeviceConfig &config;             ///< Persistence format, used directly (cold storage)
     RfMeta          rf;                  ///< Shared RF metadata
     DeviceLogic     logic;               ///< Type-specific state (movable)
     CommandSender   sender;              ///< TX queue (non-movable, shared by covers/lights)
@@ -180,6 +190,16 @@ inline void configure_sender(CommandSender &sender, const NvsDeviceConfig &cfg)
     cmd.payload[1] = cfg.payload_2;
 }
 
+/// Refresh the hot copies of config values (enabled flag, state machine contexts).
+inline void refresh_hot_config(Device &dev) {
+    dev.enabled = dev.config.is_enabled();
+    if (auto *cover = std::get_if<CoverDevice>(&dev.logic)) {
+        cover->ctx = cover_context(dev.config);
+    } else if (auto *light = std::get_if<LightDevice>(&dev.logic)) {
+        light->ctx = light_context(dev.config);
+    }
+}
+
 /// Initialize a device slot from config.
 inline void init_device(Device &dev, const NvsDeviceConfig &cfg) {
     dev.active = true;
@@ -203,11 +223,13 @@ inline void init_device(Device &dev, const NvsDeviceConfig &cfg) {
             dev.logic = RemoteDevice{};
             break;
     }
+    refresh_hot_config(dev);
 }
 
 /// Reset a device slot to empty (without assignment — Device is non-movable).
 inline void deactivate_device(Device &dev) {
     dev.active = false;
+    dev.enabled = false;
     dev.config = NvsDeviceConfig{};
     dev.rf = {};
     dev.logic = CoverDevice{};  // Reset variant to default
@@ -219,6 +241,7 @@ inline void deactivate_device(Device &dev) {
 inline void update_device_config(Device &dev, const NvsDeviceConfig &cfg) {
     dev.config = cfg;
     configure_sender(dev.sender, cfg);
+    refresh_hot_config(dev);
 
     // poll interval is hardcoded (DEFAULT_POLL_INTERVAL_MS), no config update needed
 }
@@ -0,0 +1,111 @@
+/// @file device_index.h
+/// @brief Open-addressing hash index (address, DeviceType) → registry slot.
+///
+/// DeviceRegistry::find() runs several times per received packet (log name,
+/// status dispatch, remote tracking, TX log). The index replaces the linear
+/// scan over all slots with an O(1) probe. Fixed-size, no heap.
+///
+/// Linear probing at ≤ 50% load; erase uses backward-shift deletion, so there
+/// are no tombstones and add/remove churn (auto-discovered remotes) never
+/// degrades lookups.
+
+#pragma once
+
+#include "device_type.h"
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+namespace esphome::elero {
+
+template<size_t SLOTS>
+class DeviceIndex {
+    static_assert(SLOTS > 0 && SLOTS < 0xFF, "slot index must fit in uint8_t (0xFF = empty)");
+
+    static constexpr size_t bucket_count_() {
+        size_t n = 1;
+        while (n < 2 * SLOTS) n <<= 1;
+        return n;
+    }
+
+ public:
+    static constexpr size_t BUCKETS = bucket_count_();  ///< Power of two, ≥ 2 × SLOTS
+    static constexpr uint8_t NOT_FOUND = 0xFF;
+
+    /// Map (address, type) to @p slot. Returns false if the key is already
+    /// indexed (the existing mapping is kept) or @p slot is out of range.
+    bool insert(uint32_t address, DeviceType type, uint8_t slot) {
+        if (slot >= SLOTS) return false;
+        size_t i = home_(address, type);
+        while (buckets_[i].slot != NOT_FOUND) {
+            if (buckets_[i].address == address && buckets_[i].type == type) return false;
+            i = (i + 1) & MASK;
+        }
+        buckets_[i] = {address, type, slot};
+        ++size_;
+        return true;
+    }
+
+    /// Slot index for (address, type), or NOT_FOUND.
+    [[nodiscard]] uint8_t find(uint32_t address, DeviceType type) const {
+        size_t i = home_(address, type);
+        while (buckets_[i].slot != NOT_FOUND) {
+            if (buckets_[i].address == address && buckets_[i].type == type) return buckets_[i].slot;
+            i = (i + 1) & MASK;
+        }
+        return NOT_FOUND;
+    }
+
+    /// Remove (address, type). Returns false if it was not indexed.
+    bool erase(uint32_t address, DeviceType type) {
+        size_t i = home_(address, type);
+        while (true) {
+            if (buckets_[i].slot == NOT_FOUND) return false;
+            if (buckets_[i].address == address && buckets_[i].type == type) break;
+            i = (i + 1) & MASK;
+        }
+        // Backward-shift: pull later entries of the probe run into the hole
+        // unless that would move them before their home bucket.
+        size_t hole = i;
+        size_t j = i;
+        while (true) {
+            j = (j + 1) & MASK;
+            if (buckets_[j].slot == NOT_FOUND) break;
+            size_t home = home_(buckets_[j].address, buckets_[j].type);
+            if (((j - home) & MASK) >= ((j - hole) & MASK)) {
+                buckets_[hole] = buckets_[j];
+                hole = j;
+            }
+        }
+        buckets_[hole] = Entry{};
+        --size_;
+        return true;
+    }
+
+    void clear() {
+        buckets_.fill(Entry{});
+        size_ = 0;
+    }
+
+    [[nodiscard]] size_t size() const { return size_; }
+
+ private:
+    static constexpr size_t MASK = BUCKETS - 1;
+
+    struct Entry {
+        uint32_t address{0};
+        DeviceType type{DeviceType::COVER};
+        uint8_t slot{NOT_FOUND};  ///< NOT_FOUND = empty bucket
+    };
+
+    static size_t home_(uint32_t address, DeviceType type) {
+        // Fibonacci hashing — spreads sequential addresses (same remote family)
+        uint32_t key = address ^ (static_cast<uint32_t>(type) << 24);
+        return static_cast<size_t>((key * 0x9E3779B1u) >> 16) & MASK;
+    }
+
+    std::array<Entry, BUCKETS> buckets_{};
+    size_t size_{0};
+};
+
+}  // namespace esphome::elero
@@ -5,9 +5,12 @@
 #include "state_snapshot.h"
 #include "elero.h"
 #include "overloaded.h"
+#include "radio_driver.h"
 #include "esphome/core/log.h"
 #include "esphome/core/helpers.h"
 #include "esphome/core/hal.h"
+#include <algorithm>
+#include <cmath>
 
 namespace esphome::elero {
 
@@ -34,7 +37,13 @@ void DeviceRegistry::restore_all() {
     for (size_t i = 0; i < MAX_DEVICES; ++i) {
         NvsDeviceConfig cfg{};
         if (prefs_[i].load(&cfg) && cfg.is_valid()) {
-            init_device(slots_[i], cfg);
+            Device *dup = find(cfg.dst_address, cfg.type);
+            if (dup != nullptr && dup != &slots_[i]) {
+                ESP_LOGW(TAG, "Skipping duplicate %s at 0x%06x in slot %zu",
+                         device_type_str(cfg.type), cfg.dst_address, i);
+                continue;
+            }
+            activate_(slots_[i], cfg);
             ++restored;
             ESP_LOGI(TAG, "Restored %s '%s' at 0x%06x (slot %zu)",
                      device_type_str(cfg.type), cfg.name,
@@ -42,24 +51,12 @@ void DeviceRegistry::restore_all() {
         }
     }
 
-    // Notify adapters (discovery configs, subscriptions) and queue one CHECK
-    // per cover to get real state from each blind. STATUS responses drive
-    // state through the normal dispatch_status_ → notify_state_changed_ pipeline.
-    uint32_t now = millis();
-    uint32_t cover_idx = 0;
+    // Notify adapters (discovery configs, subscriptions). Each restored cover's
+    // first poll is due immediately; the poll scheduler spaces the CHECKs out.
+    // STATUS responses drive state through the normal dispatch_status_ →
+    // notify_state_changed_ pipeline.
     for (auto &dev : slots_) {
-        if (dev.active) {
-            notify_added_(dev);
-            if (dev.is_cover()) {
-                (void) dev.sender.enqueue(packet::command::CHECK,
-                                          packet::limits::CHECK_PACKETS,
-                                          packet::msg_type::COMMAND);
-                auto &cover = std::get<CoverDevice>(dev.logic);
-                cover.poll.offset_ms = cover_idx * packet::timing::POLL_OFFSET_SPACING;
-                cover.poll.on_poll_sent(now);
-                ++cover_idx;
-            }
-        }
+        if (dev.active) notify_added_(dev);
     }
 
     ESP_LOGI(TAG, "Restored %zu devices from NVS (%zu covers, %zu lights, %zu remotes)",
@@ -71,6 +68,19 @@ void DeviceRegistry::restore_all() {
 
 void DeviceRegistry::add_adapter(OutputAdapter *adapter) {
     adapters_.push_back(adapter);
+    interests_.push_back(adapter->interest());
+    if (interests_.back().rf_packets) ++rf_listeners_;
+}
+
+void DeviceRegistry::refresh_interest(const OutputAdapter *adapter) {
+    for (size_t i = 0; i < adapters_.size(); ++i) {
+        if (adapters_[i] != adapter) continue;
+        AdapterInterest next = adapter->interest();
+        if (interests_[i].rf_packets) --rf_listeners_;
+        if (next.rf_packets) ++rf_listeners_;
+        interests_[i] = next;
+        return;
+    }
 }
 
 void DeviceRegistry::setup_adapters() {
@@ -96,6 +106,7 @@ Device *DeviceRegistry::register_device(const NvsDeviceConfig &config) {
     Device *existing = find(config.dst_address, config.type);
     if (existing) {
         update_device_config(*existing, config);
+        wake(*existing);
         notify_config_changed_(*existing);
         return existing;
     }
@@ -107,8 +118,7 @@ Device *DeviceRegistry::register_device(const NvsDeviceConfig &config) {
         return nullptr;
     }
 
-    init_device(*slot, config);
-    if (config.type == DeviceType::COVER) assign_poll_stagger_();
+    activate_(*slot, config);
     notify_added_(*slot);
     notify_state_changed_(*slot, millis());
     ESP_LOGI(TAG, "Registered %s '%s' at 0x%06x (slot %zu)",
@@ -122,6 +132,7 @@ Device *DeviceRegistry::upsert(const NvsDeviceConfig &config) {
     Device *existing = find(config.dst_address, config.type);
     if (existing) {
         update_device_config(*existing, config);
+        wake(*existing);
         persist(*existing);
         notify_config_changed_(*existing);
         ESP_LOGI(TAG, "Updated %s '%s' at 0x%06x",
@@ -137,8 +148,7 @@ Device *DeviceRegistry::upsert(const NvsDeviceConfig &config) {
         return nullptr;
     }
 
-    init_device(*slot, config);
-    if (config.type == DeviceType::COVER) assign_poll_stagger_();
+    activate_(*slot, config);
     persist(*slot);
     notify_added_(*slot);
     notify_state_changed_(*slot, millis());
@@ -163,26 +173,23 @@ bool DeviceRegistry::remove(uint32_t address, DeviceType type) {
         prefs_[idx].save(&empty);
     }
 
-    deactivate_device(*dev);
+    deactivate_(*dev);
     return true;
 }
 
 Device *DeviceRegistry::find(uint32_t address, DeviceType type) {
-    for (auto &dev : slots_) {
-        if (dev.active && dev.config.dst_address == address && dev.config.type == type) {
-            return &dev;
-        }
-    }
-    return nullptr;
+    uint8_t idx = index_.find(address, type);
+    return idx == index_.NOT_FOUND ? nullptr : &slots_[idx];
 }
 
 Device *DeviceRegistry::find(uint32_t address) {
-    for (auto &dev : slots_) {
-        if (dev.active && dev.config.dst_address == address) {
-            return &dev;
-        }
+    // Same result as a slot-order scan: the lowest slot holding the address
+    uint8_t best = index_.NOT_FOUND;
+    for (DeviceType type : {DeviceType::COVER, DeviceType::LIGHT, DeviceType::REMOTE}) {
+        uint8_t idx = index_.find(address, type);
+        if (idx < best) best = idx;
     }
-    return nullptr;
+    return best == index_.NOT_FOUND ? nullptr : &slots_[best];
 }
 
 // ═════════════════════════════════════════════════════════════════════════════
@@ -193,7 +200,7 @@ void DeviceRegistry::command_cover(Device &dev, uint8_t cmd_byte, CommandSource
     if (!dev.is_cover()) return;
 
     auto &cover = std::get<CoverDevice>(dev.logic);
-    auto ctx = cover_context(dev.config);
+    const auto &ctx = cover.ctx;
     uint32_t now = millis();
     cover.last_command_source = src;
 
@@ -203,20 +210,27 @@ void DeviceRegistry::command_cover(Device &dev, uint8_t cmd_byte, CommandSource
     }
 
     if (cmd_byte == packet::command::STOP) {
-        dev.sender.clear_queue();
-        (void) dev.sender.enqueue(cmd_byte, packet::button::PACKETS, packet::msg_type::COMMAND);
+        // STOP is a targeted 0x6a and goes out at once — never held for a group
+        cancel_tx_(dev);
+        release_hold_(slot_index_(dev));
+        (void) dev.sender.enqueue(cmd_byte, CommandSender::LINK_REPEATS, packet::msg_type::COMMAND);
         (void) dev.sender.enqueue(packet::command::CHECK, packet::limits::CHECK_PACKETS, packet::msg_type::COMMAND);
         cover.state = cover_sm::on_command(cover.state, cmd_byte, now, ctx);
         cover.target_position = cover_sm::NO_TARGET;
     } else {
         if (cmd_byte == packet::command::UP) cover.last_direction = cover_sm::Operation::OPENING;
         if (cmd_byte == packet::command::DOWN) cover.last_direction = cover_sm::Operation::CLOSING;
+        // The newest command replaces anything not yet on air
+        cancel_tx_(dev);
+        bool was_idle = !dev.sender.is_busy();
         (void) dev.sender.enqueue(cmd_byte);
         (void) dev.sender.enqueue(packet::command::CHECK, packet::limits::CHECK_PACKETS, packet::msg_type::COMMAND);
+        hold_for_coalesce_(dev, cmd_byte, was_idle, now);
         cover.state = cover_sm::on_command(cover.state, cmd_byte, now, ctx);
         cover.poll.on_command_sent(now);
     }
 
+    wake(dev);
     notify_state_changed_(dev, now);
 }
 
@@ -224,7 +238,7 @@ void DeviceRegistry::set_cover_position(Device &dev, float target, CommandSource
     if (!dev.is_cover()) return;
 
     auto &cover = std::get<CoverDevice>(dev.logic);
-    auto ctx = cover_context(dev.config);
+    const auto &ctx = cover.ctx;
     if (!cover_sm::has_position_tracking(ctx)) return;
 
     uint32_t now = millis();
@@ -242,13 +256,17 @@ void DeviceRegistry::set_cover_position(Device &dev, float target, CommandSource
         cmd = (target > current) ? packet::command::UP : packet::command::DOWN;
         cover.target_position = target;
     }
+    cancel_tx_(dev);
+    bool was_idle = !dev.sender.is_busy();
     (void) dev.sender.enqueue(cmd);
     (void) dev.sender.enqueue(packet::command::CHECK, packet::limits::CHECK_PACKETS, packet::msg_type::COMMAND);
+    hold_for_coalesce_(dev, cmd, was_idle, now);
     cover.state = cover_sm::on_command(cover.state, cmd, now, ctx);
     if (cmd == packet::command::UP) cover.last_direction = cover_sm::Operation::OPENING;
     if (cmd == packet::command::DOWN) cover.last_direction = cover_sm::Operation::CLOSING;
     cover.poll.on_command_sent(now);
 
+    wake(dev);
     notify_state_changed_(dev, now);
 }
 
@@ -256,15 +274,18 @@ void DeviceRegistry::command_cover_tilt(Device &dev, CommandSource src) {
     if (!dev.is_cover()) return;
 
     auto &cover = std::get<CoverDevice>(dev.logic);
-    auto ctx = cover_context(dev.config);
+    const auto &ctx = cover.ctx;
     uint32_t now = millis();
     cover.last_command_source = src;
 
+    cancel_tx_(dev);
+    release_hold_(slot_index_(dev));
     (void) dev.sender.enqueue(packet::command::TILT);
     (void) dev.sender.enqueue(packet::command::CHECK, packet::limits::CHECK_PACKETS, packet::msg_type::COMMAND);
     cover.state = cover_sm::on_command(cover.state, packet::command::TILT, now, ctx);
     cover.poll.on_command_sent(now);
 
+    wake(dev);
     notify_state_changed_(dev, now);
 }
 
@@ -272,7 +293,7 @@ void DeviceRegistry::command_light(Device &dev, uint8_t cmd_byte, CommandSource
     if (!dev.is_light()) return;
 
     auto &light = std::get<LightDevice>(dev.logic);
-    auto ctx = light_context(dev.config);
+    const auto &ctx = light.ctx;
     uint32_t now = millis();
     light.last_command_source = src;
 
@@ -283,15 +304,18 @@ void DeviceRegistry::command_light(Device &dev, uint8_t cmd_byte, CommandSource
 
     if (cmd_byte == packet::command::DOWN) {
         light.state = light_sm::on_turn_off(light.state);
-        dev.sender.clear_queue();
+        cancel_tx_(dev);
         (void) dev.sender.enqueue(cmd_byte);
     } else if (cmd_byte == packet::command::UP) {
         light.state = light_sm::on_turn_on(light.state, now, ctx);
+        withdraw_deferred_(dev);
         (void) dev.sender.enqueue(cmd_byte);
     } else {
+        withdraw_deferred_(dev);
         (void) dev.sender.enqueue(cmd_byte);
     }
 
+    wake(dev);
     notify_state_changed_(dev, now);
 }
 
@@ -299,19 +323,21 @@ void DeviceRegistry::set_light_brightness(Device &dev, float brightness, Command
     if (!dev.is_light()) return;
 
     auto &light = std::get<LightDevice>(dev.logic);
-    auto ctx = light_context(dev.config);
+    const auto &ctx = light.ctx;
     uint32_t now = millis();
     light.last_command_source = src;
 
     if (brightness <= 0.0f) {
         light.state = light_sm::on_turn_off(light.state);
-        dev.sender.clear_queue();
+        cancel_tx_(dev);
         (void) dev.sender.enqueue(packet::command::DOWN);
     } else if (!light_sm::supports_brightness(ctx)) {
         light.state = light_sm::on_turn_on(light.state, now, ctx);
+        withdraw_deferred_(dev);
         (void) dev.sender.enqueue(packet::command::UP);
     } else {
         light.state = light_sm::on_set_brightness(light.state, brightness, now, ctx);
+        withdraw_deferred_(dev);
         if (std::holds_alternative<light_sm::DimmingUp>(light.state)) {
             (void) dev.sender.enqueue(packet::command::UP);
         } else if (std::holds_alternative<light_sm::DimmingDown>(light.state)) {
@@ -321,6 +347,7 @@ void DeviceRegistry::set_light_brightness(Device &dev, float brightness, Command
         }
     }
 
+    wake(dev);
     notify_state_changed_(dev, now);
 }
 
@@ -348,6 +375,7 @@ void DeviceRegistry::command_group(Device *const *devices, size_t count, uint8_t
     // Build the group command on the first device's sender.
     // Set multi-dest fields so build_tx_packet_ dispatches to build_group_button_packet.
     Device &lead = *devices[0];
+    withdraw_deferred_(lead);
     auto &cmd = lead.sender.command();
     cmd.num_dests = static_cast<uint8_t>(count);
     for (size_t i = 0; i < count; ++i) {
@@ -370,7 +398,7 @@ void DeviceRegistry::command_group(Device *const *devices, size_t count, uint8_t
     for (size_t i = 0; i < count; ++i) {
         if (!devices[i]->is_cover()) continue;
         auto &cover = std::get<CoverDevice>(devices[i]->logic);
-        auto ctx = cover_context(devices[i]->config);
+        const auto &ctx = cover.ctx;
         cover.last_command_source = src;
 
         if (cmd_byte == packet::command::STOP) {
@@ -382,6 +410,7 @@ void DeviceRegistry::command_group(Device *const *devices, size_t count, uint8_t
             cover.state = cover_sm::on_command(cover.state, cmd_byte, now, ctx);
             cover.poll.on_command_sent(now);
         }
+        wake(*devices[i]);
         notify_state_changed_(*devices[i], now);
     }
 
@@ -403,6 +432,198 @@ void DeviceRegistry::command_group(Device *const *devices, size_t count, uint8_t
              }());
 }
 
+void DeviceRegistry::hold_for_coalesce_(Device &dev, uint8_t cmd_byte, bool was_idle, uint32_t now) {
+    size_t idx = slot_index_(dev);
+    // Only a fresh [cmd, CHECK] queue can be merged; anything queued behind
+    // earlier commands goes out in order.
+    if (coalesce_window_ms_ == 0 || !was_idle) {
+        release_hold_(idx);
+        return;
+    }
+    if (held_count_ == 0) coalesce_until_ms_ = now + coalesce_window_ms_;
+    if (!holds_[idx].held) ++held_count_;
+    holds_[idx] = {true, cmd_byte};
+}
+
+void DeviceRegistry::release_hold_(size_t idx) {
+    if (!holds_[idx].held) return;
+    holds_[idx].held = false;
+    --held_count_;
+}
+
+void DeviceRegistry::flush_coalesced_() {
+    std::array<Device *, GROUP_MAX_CHANNELS> group{};
+    for (size_t i = 0; i < MAX_DEVICES; ++i) {
+        if (!holds_[i].held) continue;
+
+        // Lowest held slot leads; later slots with the same cmd + remote join it
+        const uint8_t cmd_byte = holds_[i].cmd;
+        const uint32_t src_addr = slots_[i].config.src_address;
+        size_t count = 0;
+        for (size_t j = i; j < MAX_DEVICES && count < group.size(); ++j) {
+            if (!holds_[j].held || holds_[j].cmd != cmd_byte || slots_[j].config.src_address != src_addr) continue;
+            group[count++] = &slots_[j];
+            release_hold_(j);
+        }
+
+        if (count >= 2) {
+            // The lead's queued press becomes a multi-dest 0x44, the others
+            // keep only their follow-up CHECK.
+            set_group_dests_(group.data(), count);
+            for (size_t k = 1; k < count; ++k) {
+                cancel_tx_(*group[k]);
+                (void) group[k]->sender.enqueue(packet::command::CHECK, packet::limits::CHECK_PACKETS,
+                                                packet::msg_type::COMMAND);
+            }
+            ESP_LOGD(TAG, "Coalesced cmd 0x%02x for %zu covers (remote 0x%06x) into one group packet",
+                     cmd_byte, count, src_addr);
+        }
+        for (size_t k = 0; k < count; ++k) wake(*group[k]);
+    }
+}
+
+void DeviceRegistry::set_group_dests_(Device *const *group, size_t count) {
+    // Same wire format as command_group()
+    auto &cmd = group[0]->sender.command();
+    cmd.num_dests = static_cast<uint8_t>(count);
+    for (size_t k = 0; k < count; ++k) {
+        cmd.dest_channels[k] = group[k]->config.channel;
+    }
+}
+
+SceneResult DeviceRegistry::apply_scene(std::span<const SceneEntry> entries, CommandSource src) {
+    struct Move {
+        Device *dev;
+        uint8_t cmd;
+        float target;        ///< NO_TARGET for endpoint moves
+        uint32_t travel_ms;  ///< Estimated time to target/endpoint (0 without durations)
+    };
+    std::array<Move, MAX_DEVICES> moves{};
+    size_t n = 0;
+    SceneResult result;
+    uint32_t now = millis();
+
+    // A later entry for the same cover replaces an earlier one
+    auto drop_move = [&](const Device *dev) {
+        for (size_t i = 0; i < n; ++i) {
+            if (moves[i].dev != dev) continue;
+            moves[i] = moves[--n];
+            --result.applied;
+            return;
+        }
+    };
+
+    // 1. Plan — resolve each entry to a direction, target and travel time
+    for (const auto &e : entries) {
+        Device *dev = e.device;
+        if (dev == nullptr || !dev->active || !dev->is_cover()) {
+            ++result.skipped;
+            continue;
+        }
+        auto &cover = std::get<CoverDevice>(dev->logic);
+        const auto &ctx = cover.ctx;
+
+        uint8_t cmd = e.command;
+        float target = cover_sm::NO_TARGET;
+        if (cmd == packet::command::INVALID) {
+            if (!(e.position >= cover_sm::POSITION_CLOSED && e.position <= cover_sm::POSITION_OPEN)) {
+                ++result.skipped;
+                continue;
+            }
+            float current = cover_sm::position(cover.state, now, ctx);
+            if (e.position >= cover_sm::POSITION_OPEN) {
+                cmd = packet::command::UP;
+            } else if (e.position <= cover_sm::POSITION_CLOSED) {
+                cmd = packet::command::DOWN;
+            } else if (!cover_sm::has_position_tracking(ctx)) {
+                ++result.skipped;
+                continue;
+            } else {
+                target = e.position;
+                cmd = (target > current) ? packet::command::UP : packet::command::DOWN;
+            }
+        } else if (cmd != packet::command::UP && cmd != packet::command::DOWN) {
+            // STOP, TILT and CHECK are single-target — no group form
+            drop_move(dev);
+            if (cmd == packet::command::STOP || cmd == packet::command::CHECK) {
+                command_cover(*dev, cmd, src);
+            } else if (cmd == packet::command::TILT) {
+                command_cover_tilt(*dev, src);
+            } else {
+                ++result.skipped;
+                continue;
+            }
+            ++result.applied;
+            continue;
+        }
+
+        float from = cover_sm::position(cover.state, now, ctx);
+        float to = (target != cover_sm::NO_TARGET) ? target
+                 : (cmd == packet::command::UP) ? cover_sm::POSITION_OPEN : cover_sm::POSITION_CLOSED;
+        uint32_t duration = (cmd == packet::command::UP) ? ctx.open_duration_ms : ctx.close_duration_ms;
+        drop_move(dev);
+        moves[n++] = {dev, cmd, target, static_cast<uint32_t>(std::fabs(to - from) * static_cast<float>(duration))};
+        ++result.applied;
+    }
+
+    // 2. Longest travel first — it fills the first group packet and sets the
+    //    scene's completion time.
+    std::stable_sort(moves.begin(), moves.begin() + n,
+                     [](const Move &a, const Move &b) { return a.travel_ms > b.travel_ms; });
+    if (n > 0) result.completion_ms = moves[0].travel_ms;
+
+    // 3. Start presses — one 0x44 per (direction, remote), split at GROUP_MAX_CHANNELS
+    for (size_t i = 0; i < n; ++i) {
+        cancel_tx_(*moves[i].dev);
+        release_hold_(slot_index_(*moves[i].dev));
+    }
+    std::array<bool, MAX_DEVICES> queued{};
+    std::array<Device *, GROUP_MAX_CHANNELS> group{};
+    for (size_t i = 0; i < n; ++i) {
+        if (queued[i]) continue;
+        size_t count = 0;
+        for (size_t j = i; j < n && count < group.size(); ++j) {
+            if (queued[j] || moves[j].cmd != moves[i].cmd ||
+                moves[j].dev->config.src_address != moves[i].dev->config.src_address) {
+                continue;
+            }
+            group[count++] = moves[j].dev;
+            queued[j] = true;
+        }
+        if (count >= 2) {
+            set_group_dests_(group.data(), count);
+        } else {
+            group[0]->sender.command().num_dests = 0;
+        }
+        (void) group[0]->sender.enqueue(moves[i].cmd, packet::button::PACKETS, packet::msg_type::BUTTON);
+        ++result.packets;
+    }
+
+    // 4. FSMs, targets and one scheduler-spaced CHECK per cover
+    for (size_t i = 0; i < n; ++i) {
+        Device &dev = *moves[i].dev;
+        auto &cover = std::get<CoverDevice>(dev.logic);
+        cover.last_command_source = src;
+        cover.target_position = moves[i].target;
+        if (moves[i].cmd == packet::command::UP) cover.last_direction = cover_sm::Operation::OPENING;
+        if (moves[i].cmd == packet::command::DOWN) cover.last_direction = cover_sm::Operation::CLOSING;
+        cover.state = cover_sm::on_command(cover.state, moves[i].cmd, now, cover.ctx);
+        cover.poll.on_command_sent(now);
+        poll_sched_.request(static_cast<uint8_t>(slot_index_(dev)), PollPriority::RECENT_COMMAND, now);
+        wake(dev);
+        notify_state_changed_(dev, now);
+    }
+
+    ESP_LOGI(TAG, "Scene: %u covers in %u packets (%u skipped), completes in ~%ums",
+             result.applied, result.packets, result.skipped, result.completion_ms);
+    return result;
+}
+
+void DeviceRegistry::set_adaptive_link(bool enabled) {
+    adaptive_link_ = enabled;
+    for (auto &dev : slots_) dev.sender.link().set_adaptive(enabled);
+}
+
 void DeviceRegistry::request_check(Device &dev) {
     if (!dev.active) return;
     (void) dev.sender.enqueue(packet::command::CHECK, packet::limits::CHECK_PACKETS, packet::msg_type::COMMAND);
@@ -410,16 +631,30 @@ void DeviceRegistry::request_check(Device &dev) {
         auto &cover = std::get<CoverDevice>(dev.logic);
         cover.poll.on_poll_sent(millis());
     }
+    wake(dev);
 }
 
 // ═════════════════════════════════════════════════════════════════════════════
 // RF DISPATCH
 // ═════════════════════════════════════════════════════════════════════════════
 
+void DeviceRegistry::set_radio_bitrate(uint32_t bitrate_bps) {
+    if (bitrate_bps == 0) return;
+    radio_bitrate_bps_ = bitrate_bps;
+    // One poll exchange: 0x6a CHECK out + 0xca STATUS back (both 29 + length byte)
+    uint32_t exchange_us = 2 * frame_airtime_us(packet::TX_MSG_LENGTH + 1, bitrate_bps);
+    poll_sched_.set_exchange_airtime_ms((exchange_us + 999) / 1000);
+}
+
 void DeviceRegistry::on_rf_packet(const RfPacketInfo &pkt, uint32_t now) {
     // Notify all adapters of raw RF packet (web UI needs this)
     notify_rf_packet_(pkt);
 
+    // Channel occupancy for poll backoff (raw_len includes 2 appended status bytes)
+    if (pkt.raw_len > 2 && radio_bitrate_bps_ > 0) {
+        poll_sched_.on_air(now, (frame_airtime_us(pkt.raw_len - 2, radio_bitrate_bps_) + 999) / 1000);
+    }
+
     if (packet::is_status_packet(pkt.type)) {
         // Status packets: src is the blind/light reporting status
         Device *dev = find(pkt.src);
@@ -427,11 +662,18 @@ void DeviceRegistry::on_rf_packet(const RfPacketInfo &pkt, uint32_t now) {
             dev->rf.last_seen_ms = now;
             dev->rf.last_rssi = pkt.rssi;
             dev->rf.last_state_raw = pkt.state;
+            dev->sender.link().on_rssi(pkt.rssi);
             dispatch_status_(*dev, pkt.state, now);
         }
     } else if (packet::is_command_packet(pkt.type)) {
         // Remote commands are passive — we only auto-discover the remote.
-        // The blind's status response (via dispatch_status_) handles state.
+        // The blind's status response (via dispatch_status_) handles state;
+        // if we miss that reply, the cover gets one follow-up CHECK.
+        Device *target = find(pkt.dst, DeviceType::COVER);
+        if (target && target->active && target->enabled) {
+            std::get<CoverDevice>(target->logic).poll.on_remote_command(now);
+            wake(*target);
+        }
         track_remote_(pkt, now);
     }
 }
@@ -439,9 +681,13 @@ void DeviceRegistry::on_rf_packet(const RfPacketInfo &pkt, uint32_t now) {
 void DeviceRegistry::dispatch_status_(Device &dev, uint8_t state_byte, uint32_t now) {
     std::visit(overloaded{
         [&](CoverDevice &cover) {
-            auto ctx = cover_context(dev.config);
+            const auto &ctx = cover.ctx;
             cover.state = cover_sm::on_rf_status(cover.state, state_byte, now, ctx);
+            if (!cover.poll.awaiting_response) poll_sched_.on_passive_refresh();
+            if (cover.poll.check_outstanding) dev.sender.link().on_check_answered();
             cover.poll.on_rf_received(now);
+            poll_sched_.cancel(static_cast<uint8_t>(slot_index_(dev)));  // Fresh status, poll not needed
+            if (ack_aware_repeats_) on_status_ack_(dev, state_byte);
 
             // Track tilt state from RF
             if (state_byte == packet::state::TILT ||
@@ -458,11 +704,12 @@ void DeviceRegistry::dispatch_status_(Device &dev, uint8_t state_byte, uint32_t
             }
         },
         [&](LightDevice &light) {
-            auto ctx = light_context(dev.config);
+            const auto &ctx = light.ctx;
             light.state = light_sm::on_rf_status(light.state, state_byte, now, ctx);
         },
         [](RemoteDevice &) {},
     }, dev.logic);
+    wake(dev);
 
     // Always run through the snapshot→diff→publish pipeline on STATUS.
     // The diff handles dedup: if nothing changed (same RSSI, same state),
@@ -504,7 +751,7 @@ void DeviceRegistry::track_remote_(const RfPacketInfo &pkt, uint32_t now) {
         return;
     }
 
-    init_device(*slot, cfg);
+    activate_(*slot, cfg);
     auto &remote = std::get<RemoteDevice>(slot->logic);
     remote.last_command = pkt.command;
     remote.last_target = pkt.dst;
@@ -526,16 +773,37 @@ void DeviceRegistry::track_remote_(const RfPacketInfo &pkt, uint32_t now) {
 // ═════════════════════════════════════════════════════════════════════════════
 
 void DeviceRegistry::loop(uint32_t now) {
-    for (auto &dev : slots_) {
-        if (!dev.active || !dev.config.is_enabled()) continue;
+    begin_batch();
+    if (held_count_ > 0 && static_cast<int32_t>(now - coalesce_until_ms_) >= 0) {
+        flush_coalesced_();
+    }
+
+    reap_tx_();
+
+    // Visit only the devices whose deadline has passed, in slot order (TX
+    // requests of one class reach tx_sched_ in the same order as a full scan would).
+    std::array<uint8_t, MAX_DEVICES> due{};
+    size_t n = due_.pop_due(now, due.data());
+    std::sort(due.begin(), due.begin() + n);
+
+    for (size_t i = 0; i < n; ++i) {
+        Device &dev = slots_[due[i]];
+        if (!dev.active || !dev.enabled) continue;
 
         std::visit(overloaded{
             [&](CoverDevice &cover) { loop_cover_(dev, cover, now); },
             [&](LightDevice &light) { loop_light_(dev, light, now); },
             [](RemoteDevice &) {},
         }, dev.logic);
+        reschedule_(dev, now);
     }
 
+    grant_polls_(now);
+    dispatch_tx_(now);
+
+    // One notification per changed device for this whole iteration
+    flush_notifications_(now);
+
     // Drive adapter loops (MQTT reconnect, etc.)
     for (auto *a : adapters_) {
         a->loop();
@@ -543,7 +811,7 @@ void DeviceRegistry::loop(uint32_t now) {
 }
 
 void DeviceRegistry::loop_cover_(Device &dev, CoverDevice &cover, uint32_t now) {
-    auto ctx = cover_context(dev.config);
+    const auto &ctx = cover.ctx;
 
     // 1. Tick — check movement timeout and post-stop cooldown
     bool was_stopping = std::holds_alternative<cover_sm::Stopping>(cover.state);
@@ -552,18 +820,26 @@ void DeviceRegistry::loop_cover_(Device &dev, CoverDevice &cover, uint32_t now)
     bool state_type_changed = (cover.state.index() != old_idx);
 
     // 2. Poll if due — single packet suffices (blind is mains-powered, always
-    //    listening). If missed, retry via normal poll interval.
+    //    listening). If missed, retry via normal poll interval. The CHECK is
+    //    requested from the hub-wide scheduler, which spaces polls by airtime.
+    auto idx = static_cast<uint8_t>(slot_index_(dev));
+    if (cover.poll.take_missed_check(now)) {
+        poll_sched_.on_missed();
+        dev.sender.link().on_check_missed();
+    }
     bool moving = cover_sm::is_moving(cover.state);
     if (cover.poll.should_poll(now, moving)) {
-        (void) dev.sender.enqueue(packet::command::CHECK, packet::limits::CHECK_PACKETS, packet::msg_type::COMMAND);
-        cover.poll.on_poll_sent(now);
+        bool recent = cover.poll.followup_pending ||
+                      (now - cover.poll.last_command_ms) < poll_sched::RECENT_COMMAND_MS;
+        poll_sched_.request(idx, moving ? PollPriority::MOVING
+                                 : recent ? PollPriority::RECENT_COMMAND
+                                          : PollPriority::ROUTINE, now);
     }
 
     // 3. Post-stop verification — after Stopping cooldown expires, verify the
     //    blind's actual resting position (frozen estimate may drift).
     if (state_type_changed && was_stopping && std::holds_alternative<cover_sm::Idle>(cover.state)) {
-        (void) dev.sender.enqueue(packet::command::CHECK, packet::limits::CHECK_PACKETS, packet::msg_type::COMMAND);
-        cover.poll.on_poll_sent(now);
+        poll_sched_.request(idx, PollPriority::RECENT_COMMAND, now);
     }
 
     // 4. Intermediate position stop — if cover has position tracking and
@@ -578,8 +854,8 @@ void DeviceRegistry::loop_cover_(Device &dev, CoverDevice &cover, uint32_t now)
         }
         // Don't send stop for fully open/closed — the blind handles those endpoints
         if (at_target && cover.target_position > cover_sm::POSITION_CLOSED && cover.target_position < cover_sm::POSITION_OPEN) {
-            dev.sender.clear_queue();
-            (void) dev.sender.enqueue(packet::command::STOP, packet::button::PACKETS, packet::msg_type::COMMAND);
+            cancel_tx_(dev);
+            (void) dev.sender.enqueue(packet::command::STOP, CommandSender::LINK_REPEATS, packet::msg_type::COMMAND);
             (void) dev.sender.enqueue(packet::command::CHECK, packet::limits::CHECK_PACKETS, packet::msg_type::COMMAND);
             cover.state = cover_sm::on_command(cover.state, packet::command::STOP, now, ctx);
             state_type_changed = true;
@@ -587,9 +863,9 @@ void DeviceRegistry::loop_cover_(Device &dev, CoverDevice &cover, uint32_t now)
         }
     }
 
-    // 5. Process command queue
-    if (hub_) {
-        dev.sender.process_queue(now, hub_, "elero.cover");
+    // 5. Process command queue (unless held for coalescing)
+    if (hub_ && !holds_[idx].held) {
+        process_sender_(dev, now, "elero.cover");
     }
 
     // 6. Notify state changes
@@ -602,8 +878,178 @@ void DeviceRegistry::loop_cover_(Device &dev, CoverDevice &cover, uint32_t now)
     }
 }
 
+void DeviceRegistry::reschedule_(Device &dev, uint32_t now) {
+    auto idx = static_cast<uint8_t>(slot_index_(dev));
+    if (!dev.active || !dev.enabled) {
+        due_.cancel(idx);
+        return;
+    }
+    if (holds_[idx].held) {
+        due_.schedule(idx, coalesce_until_ms_);
+        return;
+    }
+    // A queued command or a TX in flight completes asynchronously (hub
+    // callback, backoff, pending timeout) — keep the device due every loop.
+    if (dev.sender.is_busy()) {
+        due_.schedule(idx, now);
+        return;
+    }
+
+    EarliestDeadline next;
+    uint32_t at = 0;
+    std::visit(overloaded{
+        [&](CoverDevice &cover) {
+            const auto &ctx = cover.ctx;
+            bool moving = cover_sm::is_moving(cover.state);
+            if (cover_sm::tick_deadline(cover.state, ctx, at)) next.consider(at);
+            // A queued poll request is woken by grant_polls_() instead
+            if (!poll_sched_.pending(static_cast<uint8_t>(slot_index_(dev))) &&
+                cover.poll.next_due(moving, at)) {
+                next.consider(at);
+            }
+            if (cover.poll.check_outstanding) {
+                next.consider(cover.poll.last_poll_ms + packet::timing::RESPONSE_WAIT_MS);
+            }
+            if (moving) {
+                next.consider(dev.last_notify_ms + packet::timing::PUBLISH_THROTTLE_MS);
+                if (cover_sm::has_position_tracking(ctx) &&
+                    cover.target_position > cover_sm::POSITION_CLOSED &&
+                    cover.target_position < cover_sm::POSITION_OPEN &&
+                    cover_sm::reach_time(cover.state, cover.target_position, ctx, at)) {
+                    next.consider(at);
+                }
+            }
+        },
+        [&](LightDevice &light) {
+            const auto &ctx = light.ctx;
+            if (light_sm::tick_deadline(light.state, ctx, at)) {
+                next.consider(at);
+                next.consider(dev.last_notify_ms + packet::timing::PUBLISH_THROTTLE_MS);
+            }
+        },
+        [](RemoteDevice &) {},
+    }, dev.logic);
+
+    if (next.set) {
+        due_.schedule(idx, next.ms);
+    } else {
+        due_.cancel(idx);
+    }
+}
+
+void DeviceRegistry::grant_polls_(uint32_t now) {
+    poll_sched_.update(now);
+    // Near the duty-cycle limit routine polls wait; at the limit every poll does
+    TxClass lowest = duty_.lowest_allowed(now);
+    if (lowest < TxClass::FOLLOW_UP) return;
+    PollPriority lowest_poll = lowest == TxClass::BACKGROUND ? PollPriority::ROUTINE : PollPriority::RECENT_COMMAND;
+    uint8_t idx = 0;
+    PollPriority prio{};
+    while (poll_sched_.take(now, idx, &prio, lowest_poll)) {
+        Device &dev = slots_[idx];
+        if (!dev.active || !dev.enabled || !dev.is_cover()) continue;
+        routine_poll_[idx] = prio == PollPriority::ROUTINE;
+        (void) dev.sender.enqueue(packet::command::CHECK, packet::limits::CHECK_PACKETS, packet::msg_type::COMMAND);
+        std::get<CoverDevice>(dev.logic).poll.on_poll_sent(now);
+        poll_sched_.on_granted(now);
+        wake(dev);
+    }
+}
+
+// ═════════════════════════════════════════════════════════════════════════════
+// TX ARBITRATION
+// ═════════════════════════════════════════════════════════════════════════════
+
+void DeviceRegistry::process_sender_(Device &dev, uint32_t now, const char *tag) {
+    TxPort port{this, static_cast<uint8_t>(slot_index_(dev)), now};
+    dev.sender.process_queue(now, &port, tag);
+}
+
+bool DeviceRegistry::submit_tx_(uint8_t idx, const TxRequest &req, uint32_t now) {
+    uint8_t cmd = req.cmd.payload[4];
+    TxClass cls = tx_class_of(cmd, routine_poll_[idx]);
+    if (cmd != packet::command::CHECK) routine_poll_[idx] = false;
+    tx_sched_.submit(idx, cls, req, now);
+    return true;
+}
+
+void DeviceRegistry::reap_tx_() {
+    if (tx_sched_.in_flight_count() == 0) return;
+    for (size_t i = 0; i < MAX_DEVICES; ++i) {
+        auto id = static_cast<uint8_t>(i);
+        if (tx_sched_.in_flight(id) && slots_[i].sender.state() != CommandSender::State::TX_PENDING) {
+            tx_sched_.on_done(id);
+        }
+    }
+}
+
+void DeviceRegistry::dispatch_tx_(uint32_t now) {
+    tx_sched_.update(now);
+    if (hub_ == nullptr || tx_sched_.queued_count() == 0) return;
+
+    uint8_t id = 0;
+    TxClass lowest = duty_.lowest_allowed(now);
+    while (tx_sched_.next(id, lowest)) {
+        const TxRequest &req = tx_sched_.request(id);
+        if (!hub_->request_tx_burst(req.client, req.cmd, req.packets, req.gap_ms)) break;  // RF queue full
+        tx_sched_.on_posted(id, now);
+        auto &sender = slots_[id].sender;
+        sender.restart_tx_timeout(now);
+        if (sender.state() != CommandSender::State::TX_PENDING) tx_sched_.on_done(id);  // Completed synchronously
+    }
+
+    // Time spent waiting here does not count toward the sender's TX timeout
+    if (tx_sched_.queued_count() == 0) return;
+    for (size_t i = 0; i < MAX_DEVICES; ++i) {
+        if (tx_sched_.queued(static_cast<uint8_t>(i))) slots_[i].sender.restart_tx_timeout(now);
+    }
+}
+
+void DeviceRegistry::cancel_tx_(Device &dev) {
+    auto idx = static_cast<uint8_t>(slot_index_(dev));
+    dev.sender.clear_queue();
+    routine_poll_[idx] = false;
+    // Completes the cancelled TX_PENDING right away instead of after it aired
+    if (tx_sched_.withdraw(idx)) dev.sender.on_tx_complete(false);
+}
+
+void DeviceRegistry::withdraw_deferred_(Device &dev) {
+    auto idx = static_cast<uint8_t>(slot_index_(dev));
+    if (!tx_sched_.queued(idx) || tx_sched_.queued_class(idx) <= TxClass::USER) return;
+    (void) tx_sched_.withdraw(idx);
+    routine_poll_[idx] = false;
+    dev.sender.skip_pending();
+}
+
+void DeviceRegistry::on_status_ack_(Device &dev, uint8_t state_byte) {
+    // Other receivers of a group press may still need its repeats
+    if (dev.sender.command().num_dests > 1) return;
+    if (!dev.sender.on_acknowledged(state_byte)) return;
+    auto idx = static_cast<uint8_t>(slot_index_(dev));
+    if (tx_sched_.withdraw(idx)) {
+        dev.sender.on_tx_complete(false);  // Remainder never aired — the ack completes it
+    } else if (hub_ != nullptr && tx_sched_.in_flight(idx)) {
+        hub_->abort_tx(&dev.sender);
+    }
+}
+
+bool DeviceRegistry::next_deadline(uint32_t &at) const {
+    EarliestDeadline next;
+    uint32_t t = 0;
+    if (due_.next_deadline(t)) next.consider(t);
+    if (poll_sched_.pending_count() > 0) next.consider(poll_sched_.next_grant_ms());
+    if (held_count_ > 0) next.consider(coalesce_until_ms_);
+    at = next.ms;
+    return next.set;
+}
+
+void DeviceRegistry::wake(Device &dev) {
+    if (!dev.active) return;
+    due_.schedule_earlier(static_cast<uint8_t>(slot_index_(dev)), millis());
+}
+
 void DeviceRegistry::loop_light_(Device &dev, LightDevice &light, uint32_t now) {
-    auto ctx = light_context(dev.config);
+    const auto &ctx = light.ctx;
 
     // 1. Tick — check dimming completion
     auto old_idx = light.state.index();
@@ -614,12 +1060,12 @@ void DeviceRegistry::loop_light_(Device &dev, LightDevice &light, uint32_t now)
     //    Button packets use RELEASE (0x00) instead of STOP (0x10).
     if (state_type_changed && !light_sm::is_dimming(light.state) &&
         light_sm::is_on(light.state)) {
-        (void) dev.sender.enqueue(packet::button::RELEASE, packet::button::PACKETS);
+        (void) dev.sender.enqueue(packet::button::RELEASE);
     }
 
     // 3. Process command queue
     if (hub_) {
-        dev.sender.process_queue(now, hub_, "elero.light");
+        process_sender_(dev, now, "elero.light");
     }
 
     // 4. Notify state changes
@@ -676,27 +1122,100 @@ Device *DeviceRegistry::find_free_slot_() {
     return nullptr;
 }
 
+void DeviceRegistry::activate_(Device &slot, const NvsDeviceConfig &config) {
+    if (slot.active) (void) index_.erase(slot.config.dst_address, slot.config.type);
+    init_device(slot, config);
+    slot.sender.link() = LinkQuality{};  // New device, new link
+    slot.sender.link().set_adaptive(adaptive_link_);
+    invalidate_snapshot_(slot);
+    (void) index_.insert(config.dst_address, config.type, static_cast<uint8_t>(slot_index_(slot)));
+    wake(slot);
+}
+
+void DeviceRegistry::deactivate_(Device &dev) {
+    (void) index_.erase(dev.config.dst_address, dev.config.type);
+    due_.cancel(static_cast<uint8_t>(slot_index_(dev)));
+    poll_sched_.cancel(static_cast<uint8_t>(slot_index_(dev)));
+    tx_sched_.cancel(static_cast<uint8_t>(slot_index_(dev)));
+    routine_poll_[slot_index_(dev)] = false;
+    release_hold_(slot_index_(dev));
+    invalidate_snapshot_(dev);
+    deactivate_device(dev);
+}
+
 size_t DeviceRegistry::slot_index_(const Device &dev) const {
     return static_cast<size_t>(&dev - slots_.data());
 }
 
 void DeviceRegistry::notify_added_(const Device &dev) {
-    for (auto *a : adapters_) a->on_device_added(dev);
+    for (size_t i = 0; i < adapters_.size(); ++i) {
+        if (interests_[i].device_events) adapters_[i]->on_device_added(dev);
+    }
 }
 
 void DeviceRegistry::notify_removed_(const Device &dev) {
-    for (auto *a : adapters_) a->on_device_removed(dev);
+    for (size_t i = 0; i < adapters_.size(); ++i) {
+        if (interests_[i].device_events) adapters_[i]->on_device_removed(dev);
+    }
 }
 
 void DeviceRegistry::notify_state_changed_(Device &dev, uint32_t now) {
+    invalidate_snapshot_(dev);
+    if (batching_) {
+        size_t idx = slot_index_(dev);
+        if (!dirty_[idx]) {
+            dirty_[idx] = true;
+            dirty_ids_[dirty_count_++] = static_cast<uint8_t>(idx);
+        }
+        return;
+    }
+    uint16_t changes = update_published_(dev, now);
+    if (changes == 0) return;
+    for (size_t i = 0; i < adapters_.size(); ++i) {
+        if (interests_[i].wants_state(dev.config.type, changes)) adapters_[i]->on_state_changed(dev, changes);
+    }
+}
+
+void DeviceRegistry::flush_notifications_(uint32_t now) {
+    batching_ = false;
+    if (dirty_count_ == 0) return;
+
+    std::sort(dirty_ids_.begin(), dirty_ids_.begin() + dirty_count_);
+    std::array<StateChange, MAX_DEVICES> batch{};
+    size_t n = 0;
+    for (size_t i = 0; i < dirty_count_; ++i) {
+        Device &dev = slots_[dirty_ids_[i]];
+        dirty_[dirty_ids_[i]] = false;
+        if (!dev.active) continue;
+        uint16_t changes = update_published_(dev, now);
+        if (changes != 0) batch[n++] = {&dev, changes};
+    }
+    dirty_count_ = 0;
+    if (n == 0) return;
+
+    // Each adapter gets only the entries it consumes (usually all of them)
+    std::array<StateChange, MAX_DEVICES> filtered{};
+    for (size_t i = 0; i < adapters_.size(); ++i) {
+        const auto &want = interests_[i];
+        size_t m = 0;
+        for (size_t j = 0; j < n; ++j) {
+            if (want.wants_state(batch[j].device->config.type, batch[j].changes)) filtered[m++] = batch[j];
+        }
+        if (m == n) {
+            adapters_[i]->on_state_batch(std::span<const StateChange>(batch.data(), n));
+        } else if (m > 0) {
+            adapters_[i]->on_state_batch(std::span<const StateChange>(filtered.data(), m));
+        }
+    }
+}
+
+uint16_t DeviceRegistry::update_published_(Device &dev, uint32_t now) {
     uint16_t changes = 0;
 
     if (dev.is_cover()) {
-        auto snap = compute_cover_snapshot(dev, now);
-        changes = diff_and_update_cover(snap, std::get<CoverDevice>(dev.logic).published);
+        changes = diff_and_update_cover(cover_snapshot(dev, now), std::get<CoverDevice>(dev.logic).published);
     } else if (dev.is_light()) {
-        auto snap = compute_light_snapshot(dev, now);
-        changes = diff_and_update_light(snap, std::get<LightDevice>(dev.logic).published);
+        changes = diff_and_update_light(light_snapshot(dev, now), std::get<LightDevice>(dev.logic).published);
     } else if (dev.is_remote()) {
         auto snap = compute_remote_snapshot(dev);
         changes = diff_and_update_remote(snap, std::get<RemoteDevice>(dev.logic).published);
@@ -704,7 +1223,7 @@ void DeviceRegistry::notify_state_changed_(Device &dev, uint32_t now) {
 
     if (changes == 0) {
         ESP_LOGVV(TAG, "0x%06x: notify suppressed (no changes)", dev.config.dst_address);
-        return;
+        return 0;
     }
 
     ESP_LOGD(TAG, "0x%06x: publish [%s] (0x%04x)",
@@ -712,15 +1231,43 @@ void DeviceRegistry::notify_state_changed_(Device &dev, uint32_t now) {
 
     dev.last_changes = changes;
     dev.last_notify_ms = now;
-    for (auto *a : adapters_) a->on_state_changed(dev, changes);
+    return changes;
+}
+
+DeviceRegistry::SnapshotMemo &DeviceRegistry::snapshot_memo_(const Device &dev, uint32_t now) const {
+    auto &memo = snapshots_[slot_index_(dev)];
+    uint32_t bucket = now / packet::timing::SNAPSHOT_BUCKET_MS;
+    if (memo.bucket != bucket) {
+        memo.bucket = bucket;
+        memo.snap = std::monostate{};
+    }
+    return memo;
+}
+
+const CoverStateSnapshot &DeviceRegistry::cover_snapshot(const Device &dev, uint32_t now) const {
+    auto &memo = snapshot_memo_(dev, now);
+    if (!std::holds_alternative<CoverStateSnapshot>(memo.snap)) memo.snap = compute_cover_snapshot(dev, now);
+    return std::get<CoverStateSnapshot>(memo.snap);
+}
+
+const LightStateSnapshot &DeviceRegistry::light_snapshot(const Device &dev, uint32_t now) const {
+    auto &memo = snapshot_memo_(dev, now);
+    if (!std::holds_alternative<LightStateSnapshot>(memo.snap)) memo.snap = compute_light_snapshot(dev, now);
+    return std::get<LightStateSnapshot>(memo.snap);
 }
 
 void DeviceRegistry::notify_config_changed_(const Device &dev) {
-    for (auto *a : adapters_) a->on_config_changed(dev);
+    invalidate_snapshot_(dev);
+    for (size_t i = 0; i < adapters_.size(); ++i) {
+        if (interests_[i].device_events) adapters_[i]->on_config_changed(dev);
+    }
 }
 
 void DeviceRegistry::notify_rf_packet_(const RfPacketInfo &pkt) {
-    for (auto *a : adapters_) a->on_rf_packet(pkt);
+    if (rf_listeners_ == 0) return;
+    for (size_t i = 0; i < adapters_.size(); ++i) {
+        if (interests_[i].rf_packets) adapters_[i]->on_rf_packet(pkt);
+    }
 }
 
 void DeviceRegistry::force_republish_all() {
@@ -745,14 +1292,4 @@ void DeviceRegistry::force_republish_all() {
     }
 }
 
-void DeviceRegistry::assign_poll_stagger_() {
-    uint32_t cover_idx = 0;
-    for (auto &dev : slots_) {
-        if (!dev.active || !dev.is_cover()) continue;
-        auto &cover = std::get<CoverDevice>(dev.logic);
-        cover.poll.offset_ms = cover_idx * packet::timing::POLL_OFFSET_SPACING;
-        ++cover_idx;
-    }
-}
-
 }  // namespace esphome::elero
@@ -9,21 +9,54 @@
 
 #pragma once
 
+#include "deadline_queue.h"
 #include "device.h"
+#include "device_index.h"
+#include "duty_cycle.h"
 #include "output_adapter.h"
+#include "poll_scheduler.h"
 #include "overloaded.h"
+#include "state_snapshot.h"
+#include "tx_scheduler.h"
 #include "esphome/core/preferences.h"
+#include <algorithm>
 #include <array>
+#include <atomic>
 #include <concepts>
+#include <span>
+#include <utility>
+#include <variant>
 #include <vector>
 
+/// Device slot capacity. Set from YAML (`elero: max_devices:`) via a build flag.
+/// Slot ids are uint8_t in the address index and deadline queue (0xFF = none).
+#ifndef ELERO_MAX_DEVICES
+#define ELERO_MAX_DEVICES 48
+#endif
+
 namespace esphome::elero {
 
 class Elero;  // Forward declaration (radio core)
 
+/// One cover in a scene (see DeviceRegistry::apply_scene). Either a command
+/// (UP/DOWN/STOP/TILT) or, with command INVALID, a target position.
+struct SceneEntry {
+    Device *device{nullptr};
+    float position{cover_sm::NO_TARGET};        ///< Target 0.0–1.0 when command is INVALID
+    uint8_t command{packet::command::INVALID};
+};
+
+struct SceneResult {
+    uint16_t applied{0};        ///< Entries acted on
+    uint16_t skipped{0};        ///< Unknown/inactive device, not a cover, or position without durations
+    uint16_t packets{0};        ///< Start presses queued (each group packet counts once)
+    uint32_t completion_ms{0};  ///< Estimated time until the last cover reaches its target
+};
+
 class DeviceRegistry {
  public:
-    static constexpr size_t MAX_DEVICES = 48;
+    static constexpr size_t MAX_DEVICES = ELERO_MAX_DEVICES;
+    static_assert(MAX_DEVICES >= 1 && MAX_DEVICES <= 254, "ELERO_MAX_DEVICES must be 1..254");
 
     // ═════════════════════════════════════════════════════════════════════════
     // LIFECYCLE
@@ -49,12 +82,25 @@ class DeviceRegistry {
     /// Register an output adapter. Call before restore_all().
     void add_adapter(OutputAdapter *adapter);
 
+    /// Re-read @p adapter's interest() (e.g. first client connected, broker lost).
+    void refresh_interest(const OutputAdapter *adapter);
+
     /// Call adapter setup (must be called before restore_all).
     void setup_adapters();
 
     /// Call from ESPHome loop(). Processes command queues, timers, timeouts, adapters.
+    /// Only devices whose deadline has passed are visited; adapters run every call.
     void loop(uint32_t now);
 
+    /// Earliest pending device deadline (poll, movement timeout, cooldown, dim end,
+    /// throttled publish, target reached). Devices with TX in flight are due every loop.
+    /// Returns false if no device needs the loop (idle fleet, polling disabled).
+    [[nodiscard]] bool next_deadline(uint32_t &at) const;
+
+    /// Make @p dev due on the next loop(). The registry's own mutators do this;
+    /// call it after changing a Device's state or sender outside the registry API.
+    void wake(Device &dev);
+
     // ═════════════════════════════════════════════════════════════════════════
     // CRUD
     // ═════════════════════════════════════════════════════════════════════════
@@ -71,10 +117,10 @@ class DeviceRegistry {
     /// Remove a device by address and type. Returns true if found and removed.
     bool remove(uint32_t address, DeviceType type);
 
-    /// Find a device by address and type.
+    /// Find a device by address and type. O(1) via the address index.
     [[nodiscard]] Device *find(uint32_t address, DeviceType type);
 
-    /// Find any device by address (first match, any type).
+    /// Find any device by address (lowest slot of any type).
     [[nodiscard]] Device *find(uint32_t address);
 
     // ═════════════════════════════════════════════════════════════════════════
@@ -106,6 +152,27 @@ class DeviceRegistry {
     void command_group(Device *const *devices, size_t count, uint8_t cmd_byte,
                        CommandSource src = CommandSource::HUB);
 
+    /// Move many covers as one plan: starts with the same direction and
+    /// src_address share 0x44 group packets (longest travel first when a
+    /// direction needs more than one packet), follow-up CHECKs go through the
+    /// poll scheduler, intermediate targets stop individually as usual.
+    /// STOP/TILT entries are sent as single commands. Pending commands of the
+    /// scene's covers are replaced.
+    SceneResult apply_scene(std::span<const SceneEntry> entries, CommandSource src = CommandSource::HUB);
+
+    /// Cover UP/DOWN commands are held for this long; held covers with
+    /// the same command byte and src_address then go out as one 0x44 group
+    /// packet instead of one packet train each. 0 sends every command at once.
+    void set_coalesce_window(uint32_t ms) { coalesce_window_ms_ = ms; }
+
+    /// Stop sending a cover command's repeats, and skip its follow-up CHECK,
+    /// once the cover's status shows it took effect. On by default.
+    void set_ack_aware_repeats(bool enabled) { ack_aware_repeats_ = enabled; }
+
+    /// Learn repeat count, retry limit and retry backoff per device from its
+    /// link statistics (see link_quality.h). Off: fixed defaults for all.
+    void set_adaptive_link(bool enabled);
+
     /// Request an immediate status CHECK for any device (cover or light).
     /// Enqueues a single CHECK packet — blind responds with current state.
     void request_check(Device &dev);
@@ -114,14 +181,53 @@ class DeviceRegistry {
     // RF DISPATCH
     // ═════════════════════════════════════════════════════════════════════════
 
+    /// Share of airtime status polls may use (default 10%). See poll_scheduler.h.
+    void set_poll_airtime_budget(float fraction) { poll_sched_.set_budget(fraction); }
+    [[nodiscard]] const PollScheduler<MAX_DEVICES> &poll_scheduler() const { return poll_sched_; }
+    /// On-air bitrate of the radio (RadioDriver::bitrate_bps()): sets the
+    /// poll exchange airtime and enables RF occupancy measurement.
+    void set_radio_bitrate(uint32_t bitrate_bps);
+    /// Hub-wide TX arbitration (per-class queueing delay). See tx_scheduler.h.
+    [[nodiscard]] const TxScheduler<MAX_DEVICES> &tx_scheduler() const { return tx_sched_; }
+
+    /// Allowed share of airtime for our own TX (default 1%). See duty_cycle.h.
+    void set_duty_cycle_limit(float fraction) { duty_.set_limit(fraction); }
+    [[nodiscard]] const DutyCycle &duty_cycle() const { return duty_; }
+    /// The RF task sent @p airtime_us since the last call. Polls and CHECKs are
+    /// deferred while the budget is nearly used up.
+    void on_tx_airtime(uint32_t now, uint32_t airtime_us) { duty_.on_tx(now, airtime_us); }
+
     /// Process a decoded RF packet. Updates device state machines, notifies adapters.
     void on_rf_packet(const RfPacketInfo &pkt, uint32_t now);
 
+    /// Raw RF frame capture demand. Adapters that forward raw bytes (e.g. the
+    /// WebSocket "rf" event) hold a reference while they have a listener; the
+    /// RF task copies raw frames only while at least one reference is held.
+    void acquire_raw_capture() { raw_capture_refs_.fetch_add(1, std::memory_order_relaxed); }
+    void release_raw_capture() { raw_capture_refs_.fetch_sub(1, std::memory_order_relaxed); }
+    /// Safe to call from the RF task (Core 0).
+    [[nodiscard]] bool raw_capture_wanted() const { return raw_capture_refs_.load(std::memory_order_relaxed) > 0; }
+
     /// Reset all Published caches and re-notify adapters through the normal
     /// snapshot→diff→update pipeline. Use when an adapter's downstream (e.g. MQTT
     /// broker) has lost state and needs a full republish.
     void force_republish_all();
 
+    /// Defer state notifications until the end of the next loop(). The hub
+    /// calls this before dispatching received packets, so an RF status and a
+    /// tick transition in the same iteration reach adapters as one update.
+    /// loop() itself always batches; outside a batch, notifications are
+    /// immediate (commands from adapters and the native API).
+    void begin_batch() { batching_ = true; }
+
+    /// Memoized snapshot of an active registry device. Computed at most once
+    /// per state change and SNAPSHOT_BUCKET_MS bucket — the publish diff and
+    /// every adapter in the same tick share it. Adapters read state through
+    /// these instead of calling compute_*_snapshot() themselves. The reference
+    /// is valid until the next registry call.
+    const CoverStateSnapshot &cover_snapshot(const Device &dev, uint32_t now) const;
+    const LightStateSnapshot &light_snapshot(const Device &dev, uint32_t now) const;
+
     // ═════════════════════════════════════════════════════════════════════════
     // ITERATION
     // ═════════════════════════════════════════════════════════════════════════
@@ -168,11 +274,68 @@ class DeviceRegistry {
     void persist(Device &dev);
 
  private:
-    std::array<Device, MAX_DEVICES> slots_{};
+    template<size_t... I>
+    static std::array<Device, MAX_DEVICES> make_slots_(std::array<NvsDeviceConfig, MAX_DEVICES> &configs,
+                                                       std::index_sequence<I...>) {
+        return {Device{configs[I]}...};
+    }
+
+    // Cold: names, addressing, persistence metadata — read on CRUD/publish paths.
+    // Hot: per-device runtime state — the only data the loop touches.
+    std::array<NvsDeviceConfig, MAX_DEVICES> configs_{};
+    std::array<Device, MAX_DEVICES> slots_{make_slots_(configs_, std::make_index_sequence<MAX_DEVICES>{})};
+    DeviceIndex<MAX_DEVICES> index_;  ///< (address, type) → slot; kept in sync by activate_/deactivate_
+    DeadlineQueue<MAX_DEVICES> due_;  ///< slot → next loop deadline; see reschedule_()
+    uint32_t radio_bitrate_bps_{0};          ///< 0 until set_radio_bitrate(): received airtime unknown
+    PollScheduler<MAX_DEVICES> poll_sched_;  ///< Hub-wide CHECK spacing; covers request, grant_polls_() sends
+    TxScheduler<MAX_DEVICES> tx_sched_;      ///< Senders submit here; dispatch_tx_() feeds the RF task
+    DutyCycle duty_;                         ///< Own airtime; gates grant_polls_() and dispatch_tx_()
+    std::array<bool, MAX_DEVICES> routine_poll_{};  ///< Slot's queued CHECK is a ROUTINE poll (BACKGROUND class)
+
+    /// What a device's sender sees as its hub: requests go to tx_sched_.
+    struct TxPort {
+        DeviceRegistry *registry;
+        uint8_t slot;
+        uint32_t now;
+        bool request_tx_burst(TxClient *client, const EleroCommand &cmd, uint8_t packets, uint8_t gap_ms) {
+            return registry->submit_tx_(slot, {client, cmd, packets, gap_ms}, now);
+        }
+    };
+
+    /// Channels per group packet: the FIFO fits GROUP_MAX_DESTS, but receivers
+    /// (and parse_packet) reject frames listing more than MAX_DESTINATIONS.
+    static constexpr size_t GROUP_MAX_CHANNELS = std::min<size_t>(packet::GROUP_MAX_DESTS, packet::MAX_DESTINATIONS);
+
+    // Command coalescing — a held cover's sender has [cmd, CHECK] queued and
+    // is not processed until flush_coalesced_() runs at coalesce_until_ms_.
+    struct CoalesceHold {
+        bool held{false};
+        uint8_t cmd{0};
+    };
+    std::array<CoalesceHold, MAX_DEVICES> holds_{};
+    size_t held_count_{0};
+    uint32_t coalesce_until_ms_{0};
+    uint32_t coalesce_window_ms_{packet::timing::COALESCE_WINDOW_MS};
+    bool ack_aware_repeats_{true};
+    bool adaptive_link_{true};
+    bool batching_{false};
+    std::array<bool, MAX_DEVICES> dirty_{};      ///< Slot has a deferred notification
+    std::array<uint8_t, MAX_DEVICES> dirty_ids_{};
+    size_t dirty_count_{0};
+
+    // Snapshot memo — empty (monostate) until first read after a state change.
+    struct SnapshotMemo {
+        uint32_t bucket{0};
+        std::variant<std::monostate, CoverStateSnapshot, LightStateSnapshot> snap;
+    };
+    mutable std::array<SnapshotMemo, MAX_DEVICES> snapshots_{};
     std::vector<OutputAdapter *> adapters_;
+    std::vector<AdapterInterest> interests_;  ///< Parallel to adapters_
+    size_t rf_listeners_{0};                  ///< Adapters with interest().rf_packets
     Elero *hub_{nullptr};
     bool nvs_enabled_{false};
     HubMode mode_{HubMode::NATIVE};
+    std::atomic<uint16_t> raw_capture_refs_{0};
 
     // NVS preference handles (one per slot)
     ESPPreferenceObject prefs_[MAX_DEVICES]{};
@@ -180,10 +343,20 @@ class DeviceRegistry {
 
     // ── Internal helpers ──
     Device *find_free_slot_();
+    void activate_(Device &slot, const NvsDeviceConfig &config);  ///< init_device + index insert
+    void deactivate_(Device &dev);                                 ///< index erase + deactivate_device
     size_t slot_index_(const Device &dev) const;
     void notify_added_(const Device &dev);
     void notify_removed_(const Device &dev);
     void notify_state_changed_(Device &dev, uint32_t now);
+    /// Memo entry for @p dev at @p now, cleared if it belongs to an older bucket.
+    SnapshotMemo &snapshot_memo_(const Device &dev, uint32_t now) const;
+    void invalidate_snapshot_(const Device &dev) { snapshots_[slot_index_(dev)].snap = std::monostate{}; }
+    /// Snapshot→diff against the Published cache. Returns the changed fields
+    /// (0 = nothing to publish) and stamps last_changes/last_notify_ms.
+    uint16_t update_published_(Device &dev, uint32_t now);
+    /// End of batch: publish every dirty device once, as one on_state_batch().
+    void flush_notifications_(uint32_t now);
     void notify_config_changed_(const Device &dev);
     void notify_rf_packet_(const RfPacketInfo &pkt);
 
@@ -193,15 +366,47 @@ class DeviceRegistry {
     /// Process light device loop (dimming, command queue).
     void loop_light_(Device &dev, LightDevice &light, uint32_t now);
 
+    /// Queue @p dev for the earliest time loop_cover_/loop_light_ can act on it.
+    void reschedule_(Device &dev, uint32_t now);
+
+    /// Hold a cover command just queued on @p dev for coalescing. @p was_idle:
+    /// the sender had nothing queued or in flight before (else no hold).
+    void hold_for_coalesce_(Device &dev, uint8_t cmd_byte, bool was_idle, uint32_t now);
+    void release_hold_(size_t idx);
+
+    /// Coalescing window closed — merge held covers into group packets.
+    void flush_coalesced_();
+
+    /// Turn @p group[0]'s next BUTTON press into a multi-dest 0x44 for all
+    /// @p count covers' channels (2 ≤ count ≤ GROUP_MAX_CHANNELS).
+    static void set_group_dests_(Device *const *group, size_t count);
+
+    /// Send the poll CHECKs the scheduler's airtime budget allows right now.
+    void grant_polls_(uint32_t now);
+
+    // ── TX arbitration ──
+    void process_sender_(Device &dev, uint32_t now, const char *tag);
+    bool submit_tx_(uint8_t idx, const TxRequest &req, uint32_t now);
+    /// Release in-flight entries whose sender has had its completion.
+    void reap_tx_();
+    /// Hand the best queued requests to the RF task, up to tx_sched::MAX_IN_FLIGHT.
+    void dispatch_tx_(uint32_t now);
+    /// clear_queue() that also withdraws a request still waiting in tx_sched_,
+    /// so it never goes on air.
+    void cancel_tx_(Device &dev);
+    /// A new command for @p dev: drop a CHECK or poll of it still waiting in
+    /// tx_sched_ — under the duty-cycle limit it could wait indefinitely,
+    /// holding the command back in the sender's queue.
+    void withdraw_deferred_(Device &dev);
+    /// A status from @p dev: end its command early if the status acknowledges it.
+    void on_status_ack_(Device &dev, uint8_t state_byte);
+
     /// Handle an RF status packet for a specific device.
     /// Always runs through snapshot→diff→publish; the diff handles dedup.
     void dispatch_status_(Device &dev, uint8_t state_byte, uint32_t now);
 
     /// Track a remote control from an observed RF command packet.
     void track_remote_(const RfPacketInfo &pkt, uint32_t now);
-
-    /// Assign staggered poll offsets to all active covers.
-    void assign_poll_stagger_();
 };
 
 }  // namespace esphome::elero
@@ -0,0 +1,129 @@
+/// @file duty_cycle.h
+/// @brief Airtime accounting against the 868 MHz duty-cycle limit.
+///
+/// The gateway transmits in the 868.0–868.6 MHz sub-band, where ETSI EN 300 220
+/// allows 1 % duty cycle — 36 s on air per hour. The RF task adds the airtime
+/// of every packet it sends (RadioDriver::airtime_us()); DutyCycle keeps the
+/// totals for the last minute and the last hour and decides which TX classes
+/// may still go out:
+///
+///   budget used < NEAR_LIMIT    → everything
+///   NEAR_LIMIT ≤ used < 100 %   → no routine polls (BACKGROUND deferred)
+///   used ≥ 100 %                → commands only (FOLLOW_UP CHECKs deferred too)
+///
+/// "Used" is the larger of the hour window and the minute window, each measured
+/// against the limit × its length — so a poll storm is stopped within the
+/// minute instead of spending the whole hour's budget first. User commands and
+/// STOP are never deferred: they are few and short, and a blind that does not
+/// stop is worse than a brief excess.
+///
+/// Windows are bucketed (5 s / 1 min buckets): a bucket leaves the window as a
+/// whole, up to one bucket width early.
+///
+/// Pure logic, no ESPHome deps. Fixed-size, no heap.
+
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include "tx_scheduler.h"
+
+namespace esphome::elero {
+
+namespace duty {
+constexpr float DEFAULT_LIMIT = 0.01f;   ///< ETSI EN 300 220, 868.0–868.6 MHz: 1 %
+constexpr float NEAR_LIMIT = 0.8f;       ///< Share of the budget at which background traffic stops
+constexpr uint32_t MINUTE_MS = 60000;
+constexpr uint32_t HOUR_MS = 3600000;
+constexpr size_t MINUTE_BUCKETS = 12;    ///< 5 s each
+constexpr size_t HOUR_BUCKETS = 60;      ///< 1 min each
+}  // namespace duty
+
+/// Airtime sum over the last SPAN_MS, in BUCKETS buckets.
+template<size_t BUCKETS, uint32_t SPAN_MS>
+class AirtimeWindow {
+ public:
+    static constexpr uint32_t BUCKET_MS = SPAN_MS / BUCKETS;
+
+    void add(uint32_t now, uint32_t airtime_us) {
+        uint32_t epoch = now / BUCKET_MS;
+        auto &b = buckets_[epoch % BUCKETS];
+        if (b.epoch != epoch) b = {epoch, 0};
+        b.airtime_us += airtime_us;
+    }
+
+    [[nodiscard]] uint32_t total_us(uint32_t now) const {
+        uint32_t epoch = now / BUCKET_MS;
+        uint32_t sum = 0;
+        for (const auto &b : buckets_) {
+            if (epoch - b.epoch < BUCKETS) sum += b.airtime_us;
+        }
+        return sum;
+    }
+
+ private:
+    struct Bucket {
+        uint32_t epoch{0};
+        uint32_t airtime_us{0};
+    };
+    std::array<Bucket, BUCKETS> buckets_{};
+};
+
+class DutyCycle {
+ public:
+    /// Allowed share of airtime (0 < fraction ≤ 1).
+    void set_limit(float fraction) {
+        if (fraction > 0.0f && fraction <= 1.0f) limit_ = fraction;
+    }
+    [[nodiscard]] float limit() const { return limit_; }
+
+    /// @p airtime_us of our own TX, ending around @p now.
+    void on_tx(uint32_t now, uint32_t airtime_us) {
+        if (airtime_us == 0) return;
+        minute_.add(now, airtime_us);
+        hour_.add(now, airtime_us);
+        total_us_ += airtime_us;
+    }
+
+    [[nodiscard]] uint32_t minute_us(uint32_t now) const { return minute_.total_us(now); }
+    [[nodiscard]] uint32_t hour_us(uint32_t now) const { return hour_.total_us(now); }
+    /// All airtime ever accounted (wraps after ~71 min on air).
+    [[nodiscard]] uint32_t total_us() const { return total_us_; }
+
+    /// Hour budget at the current limit.
+    [[nodiscard]] uint32_t hour_budget_us() const { return budget_us_(duty::HOUR_MS); }
+    /// Airtime left in the hour window (0 once exhausted).
+    [[nodiscard]] uint32_t hour_remaining_us(uint32_t now) const {
+        uint32_t used = hour_us(now);
+        uint32_t budget = hour_budget_us();
+        return used < budget ? budget - used : 0;
+    }
+
+    /// Share of the budget used: the larger of the minute and hour windows.
+    [[nodiscard]] float used(uint32_t now) const {
+        float m = static_cast<float>(minute_us(now)) / static_cast<float>(budget_us_(duty::MINUTE_MS));
+        float h = static_cast<float>(hour_us(now)) / static_cast<float>(hour_budget_us());
+        return m > h ? m : h;
+    }
+
+    /// Lowest-priority TX class that may go on air at @p now.
+    [[nodiscard]] TxClass lowest_allowed(uint32_t now) const {
+        float u = used(now);
+        if (u >= 1.0f) return TxClass::USER;
+        if (u >= duty::NEAR_LIMIT) return TxClass::FOLLOW_UP;
+        return TxClass::BACKGROUND;
+    }
+
+ private:
+    [[nodiscard]] uint32_t budget_us_(uint32_t span_ms) const {
+        return static_cast<uint32_t>(static_cast<float>(span_ms) * 1000.0f * limit_);
+    }
+
+    float limit_{duty::DEFAULT_LIMIT};
+    AirtimeWindow<duty::MINUTE_BUCKETS, duty::MINUTE_MS> minute_;
+    AirtimeWindow<duty::HOUR_BUCKETS, duty::HOUR_MS> hour_;
+    uint32_t total_us_{0};
+};
+
+}  // namespace esphome::elero
@@ -30,17 +30,37 @@ static const char *const TAG_RF = "elero.rf";
 
 void Elero::loop() {
 #ifdef USE_ESP32
-  // ─── Core 1: Drain FreeRTOS queues from RF task, run ESPHome dispatch ──────
-
-  // 1. Drain decoded RX packets from RF task
-  RfPacketInfo pkt{};
-  while (xQueueReceive(this->rx_queue_handle_, &pkt, 0) == pdPASS) {
-    this->dispatch_packet(pkt);
+  // ─── Core 1: Drain RX ring and FreeRTOS queues from RF task, run dispatch ──
+
+  // 1. Dispatch decoded RX packets in place from the RX ring.
+  //    Captured raw frames are committed in the same order, one per pkt->raw.
+  //    State notifications are batched until the registry loop below ends.
+  if (this->registry_ != nullptr)
+    this->registry_->begin_batch();
+  while (const RfPacketInfo *pkt = this->rx_ring_.front()) {
+    this->dispatch_packet(*pkt);
+    if (pkt->raw != nullptr)
+      this->raw_ring_.pop();
+    this->rx_ring_.pop();
   }
 
   // 2. Drain TX completion results and notify CommandSenders
   TxResult result{};
   while (xQueueReceive(this->tx_done_queue_handle_, &result, 0) == pdPASS) {
+    // An abort still aimed at this TX came too late; it must not cut the
+    // client's next one. Clear only that owner's — a queued TX may have its own.
+    TxClient *expected = result.client;
+    this->tx_abort_.compare_exchange_strong(expected, nullptr, std::memory_order_relaxed);
+    if (result.burst.packets > 0) {
+      // Burst: one result covers every packet
+      uint8_t ok = result.burst.sent_ok();
+      this->stat_tx_success_ += ok;
+      this->stat_tx_fail_ += result.burst.packets - ok;
+      if (result.client != nullptr) {
+        result.client->on_tx_burst_complete(result.burst);
+      }
+      continue;
+    }
     if (result.success) {
       this->stat_tx_success_++;
     } else {
@@ -51,9 +71,15 @@ void Elero::loop() {
     }
   }
 
-  // 3. Registry loop (state machines, command queues, adapter loops)
+  // 3. Registry loop (state machines, command queues, adapter loops).
+  //    Airtime the RF task spent since the last loop goes to the duty-cycle
+  //    accountant first, so this loop's polls and CHECKs see it.
   if (this->registry_ != nullptr) {
-    this->registry_->loop(millis());
+    uint32_t now = millis();
+    uint32_t airtime_us = this->stat_airtime_us_.load(std::memory_order_relaxed);
+    this->registry_->on_tx_airtime(now, airtime_us - this->airtime_seen_us_);
+    this->airtime_seen_us_ = airtime_us;
+    this->registry_->loop(now);
   }
 
   // 4. Publish RF stats sensors (throttled to every 30s)
@@ -71,6 +97,9 @@ void Elero::decode_fifo_packets_(size_t fifo_count) {
   ESP_LOGV(TAG, "RAW RX %d bytes: %s", static_cast<int>(fifo_count),
            format_hex_pretty(this->msg_rx_, fifo_count).c_str());
 
+  // Raw bytes are only copied while an adapter (e.g. WebSocket client) wants them
+  const bool capture_raw = this->registry_ != nullptr && this->registry_->raw_capture_wanted();
+
   // Parse multiple packets from the buffer
   size_t offset = 0;
   int pkt_count = 0;
@@ -91,14 +120,24 @@ void Elero::decode_fifo_packets_(size_t fifo_count) {
       break;
     }
 
-    auto pkt = this->decode_packet(this->msg_rx_ + offset, fifo_count - offset);
-    if (pkt) {
-#ifdef USE_ESP32
-      if (xQueueSend(this->rx_queue_handle_, &(*pkt), 0) != pdPASS) {
-        ESP_LOGW(TAG, "RX queue full, dropping packet cnt=%d", pkt->cnt);
+    // Decode straight into the next RX ring slot; publish only if valid
+    RfPacketInfo *slot = this->rx_ring_.acquire();
+    if (slot == nullptr) {
+      // Only a valid packet counts as a drop — noise and CRC garbage would be discarded anyway
+      if (packet::parse_packet(this->msg_rx_ + offset, fifo_count - offset).valid) {
+        ESP_LOGW(TAG, "RX ring full, dropping packet at offset %d", static_cast<int>(offset));
         this->stat_rx_drops_.fetch_add(1, std::memory_order_relaxed);
       }
-#endif
+    } else if (this->decode_packet(this->msg_rx_ + offset, fifo_count - offset, *slot)) {
+      // Raw capture is best-effort: a full capture ring drops the bytes, not the packet
+      RfRawFrame *raw = capture_raw ? this->raw_ring_.acquire() : nullptr;
+      if (raw != nullptr) {
+        raw->len = slot->raw_len;
+        memcpy(raw->bytes, this->msg_rx_ + offset, raw->len);
+        this->raw_ring_.commit();
+      }
+      slot->raw = raw;
+      this->rx_ring_.commit();
       ++pkt_count;
     }
 
@@ -128,7 +167,7 @@ void IRAM_ATTR Elero::interrupt(Elero *arg) {
   }
 
 #ifdef USE_ESP32
-  // Wake RF task immediately (bypasses 1ms sleep)
+  // Wake RF task immediately (it sleeps until notified or a deadline)
   if (arg->rf_task_handle_ != nullptr) {
     BaseType_t woken = pdFALSE;
     vTaskNotifyGiveFromISR(arg->rf_task_handle_, &woken);
@@ -146,6 +185,15 @@ void Elero::dump_config() {
   }
   if (this->registry_) {
     ESP_LOGCONFIG(TAG, "  Registered devices: %d", this->registry_->count_active());
+    ESP_LOGCONFIG(TAG, "  Duty cycle limit: %.1f%%", this->registry_->duty_cycle().limit() * 100.0f);
+  }
+  ESP_LOGCONFIG(TAG, "  RX ring: %u slots (%u bytes each), high water %u", static_cast<unsigned>(RX_RING_SIZE),
+                static_cast<unsigned>(sizeof(RfPacketInfo)), static_cast<unsigned>(this->rx_ring_.high_water()));
+  ESP_LOGCONFIG(TAG, "  Raw capture ring: %u slots", static_cast<unsigned>(RAW_RING_SIZE));
+  if (this->lbt_.enabled()) {
+    ESP_LOGCONFIG(TAG, "  Listen-before-talk: busy at >= %d dBm", this->lbt_.busy_dbm());
+  } else {
+    ESP_LOGCONFIG(TAG, "  Listen-before-talk: off");
   }
 }
 
@@ -181,6 +229,9 @@ void Elero::setup() {
 
   // New architecture: device registry lifecycle
   if (this->registry_ != nullptr) {
+    // Poll spacing and RF occupancy use the configured radio's bitrate
+    this->registry_->set_radio_bitrate(this->driver_->bitrate_bps());
+
     // Setup all output adapters (MQTT, etc.) before restoring devices
     this->registry_->setup_adapters();
 
@@ -193,12 +244,11 @@ void Elero::setup() {
 
 #ifdef USE_ESP32
   // ─── Create FreeRTOS queues and spawn RF task on Core 0 ────────────────────
-  this->rx_queue_handle_ = xQueueCreate(16, sizeof(RfPacketInfo));
+  // RX uses rx_ring_ (lock-free, in-place); TX paths keep FreeRTOS queues.
   this->tx_queue_handle_ = xQueueCreate(8, sizeof(RfTaskRequest));
   this->tx_done_queue_handle_ = xQueueCreate(4, sizeof(TxResult));
 
-  if (this->rx_queue_handle_ == nullptr ||
-      this->tx_queue_handle_ == nullptr ||
+  if (this->tx_queue_handle_ == nullptr ||
       this->tx_done_queue_handle_ == nullptr) {
     ESP_LOGE(TAG, "Failed to create FreeRTOS queues (heap exhausted?)");
     this->mark_failed();
@@ -224,14 +274,24 @@ void Elero::setup() {
 #endif
 }
 
+void Elero::notify_rf_task_() {
+#ifdef USE_ESP32
+  if (this->rf_task_handle_ != nullptr)
+    xTaskNotifyGive(this->rf_task_handle_);
+#endif
+}
+
 // ─── RF Task: Core 0 dedicated radio controller ─────────────────────────────
 // Owns all SPI access after setup(). Communicates with main loop via FreeRTOS
-// queues only. Woken by GDO0 ISR notification or 1ms timeout.
+// queues and the RX ring only. Event-driven: sleeps until notified by the radio
+// ISR or a new tx_queue request, or until a deadline (see rf_task_timing.h).
 #ifdef USE_ESP32
 void Elero::rf_task_func_(void *arg) {
   auto *self = static_cast<Elero *>(arg);
   uint32_t last_stack_check_ms = 0;
+  uint32_t next_health_ms = millis() + packet::timing::RADIO_WATCHDOG_INTERVAL;
   bool tx_in_progress = false;
+  rf_task::LoadMeter load;
 
   for (;;) {
     // If driver signaled unrecoverable failure, stop all radio operations.
@@ -246,20 +306,17 @@ void Elero::rf_task_func_(void *arg) {
     uint32_t now = millis();
 
     // 1. Process TX requests from main loop (only when radio is idle)
-    if (!tx_in_progress) {
+    if (!tx_in_progress && !self->tx_burst_.active()) {
       RfTaskRequest req{};
       if (xQueueReceive(self->tx_queue_handle_, &req, 0) == pdPASS) {
         switch (req.type) {
           case RfTaskRequest::Type::TX:
+          case RfTaskRequest::Type::TX_BURST:
+            // Built once: repeats of a press share the counter, like a real remote
             self->build_tx_packet_(req.cmd);
-            if (self->driver_->load_and_transmit(self->msg_tx_, self->msg_tx_[0] + 1)) {
-              self->tx_owner_ = req.client;
-              tx_in_progress = true;
-            } else {
-              // load_and_transmit failed — report failure immediately
-              TxResult r{req.client, false};
-              xQueueSend(self->tx_done_queue_handle_, &r, 0);
-            }
+            self->tx_owner_ = req.client;
+            self->tx_burst_report_ = req.type == RfTaskRequest::Type::TX_BURST;
+            self->tx_burst_.start(self->tx_burst_report_ ? req.burst_packets : 1, req.burst_gap_ms, now);
             break;
 
           case RfTaskRequest::Type::REINIT_FREQ:
@@ -281,7 +338,36 @@ void Elero::rf_task_func_(void *arg) {
       }
     }
 
-    // 2. Progress TX via driver
+    // 2. Load the next packet of the current burst once its gap has elapsed,
+    //    unless the receiver has acknowledged it already (abort_tx()).
+    //    Listen first: on a busy channel the packet waits a jittered backoff.
+    //    An abort that arrived before the first packet stays pending until
+    //    that packet is out; the main loop may post a newer abort meanwhile.
+    if (!tx_in_progress && self->tx_owner_ != nullptr &&
+        self->tx_abort_.load(std::memory_order_acquire) == self->tx_owner_ && self->tx_burst_.abort()) {
+      TxClient *expected = self->tx_owner_;
+      self->tx_abort_.compare_exchange_strong(expected, nullptr, std::memory_order_relaxed);
+    }
+    if (!tx_in_progress && self->tx_burst_.due(now) && self->lbt_.enabled()) {
+      int16_t rssi = 0;
+      bool sampled = self->driver_->sample_rssi(rssi);
+      uint32_t lbt_wait = self->lbt_.check(sampled, rssi, now, random_uint32());
+      self->stat_lbt_clear_.store(self->lbt_.clear_total(), std::memory_order_relaxed);
+      self->stat_lbt_busy_.store(self->lbt_.busy_total(), std::memory_order_relaxed);
+      self->stat_lbt_forced_.store(self->lbt_.forced_total(), std::memory_order_relaxed);
+      if (lbt_wait > 0)
+        self->tx_burst_.defer(now + lbt_wait);
+    }
+    if (!tx_in_progress && self->tx_burst_.due(now)) {
+      if (self->driver_->load_and_transmit(self->msg_tx_, self->msg_tx_[0] + 1)) {
+        tx_in_progress = true;
+      } else {
+        // load_and_transmit failed — this packet fails, the burst goes on
+        self->tx_burst_.on_packet_done(false, now);
+      }
+    }
+
+    // 3. Progress TX via driver
     if (tx_in_progress) {
       auto result = self->driver_->poll_tx();
       switch (result) {
@@ -289,27 +375,31 @@ void Elero::rf_task_func_(void *arg) {
           break;
         case TxPollResult::SUCCESS:
           ESP_LOGV(TAG, "TX complete (success)");
-          {
-            TxResult r{self->tx_owner_, true};
-            self->tx_owner_ = nullptr;
-            tx_in_progress = false;
-            xQueueSend(self->tx_done_queue_handle_, &r, 0);
-          }
+          self->stat_airtime_us_.fetch_add(self->driver_->airtime_us(self->msg_tx_[0] + 1), std::memory_order_relaxed);
+          tx_in_progress = false;
+          self->tx_burst_.on_packet_done(true, millis());
           break;
         case TxPollResult::FAILED:
           ESP_LOGW(TAG, "TX complete (failed)");
           self->stat_tx_recover_.fetch_add(1, std::memory_order_relaxed);
-          {
-            TxResult r{self->tx_owner_, false};
-            self->tx_owner_ = nullptr;
-            tx_in_progress = false;
-            xQueueSend(self->tx_done_queue_handle_, &r, 0);
-          }
+          // Counted as a full packet: the radio may have been on air until it failed
+          self->stat_airtime_us_.fetch_add(self->driver_->airtime_us(self->msg_tx_[0] + 1), std::memory_order_relaxed);
+          tx_in_progress = false;
+          self->tx_burst_.on_packet_done(false, millis());
           break;
       }
     }
 
-    // 3. Drain FIFO if GDO0 interrupt fired (RX mode only — has_data guards this)
+    // 4. Report once every packet of the TX/burst has a result
+    if (self->tx_burst_.finished()) {
+      const TxBurstReport &report = self->tx_burst_.report();
+      TxResult r{self->tx_owner_, report.all_ok(), self->tx_burst_report_ ? report : TxBurstReport{}};
+      self->tx_owner_ = nullptr;
+      self->tx_burst_.clear();
+      xQueueSend(self->tx_done_queue_handle_, &r, 0);
+    }
+
+    // 5. Drain FIFO if GDO0 interrupt fired (RX mode only — has_data guards this)
     if (self->driver_->has_data()) {
       // Clear RX flag
       self->rx_ready_.store(false, std::memory_order_release);
@@ -321,8 +411,11 @@ void Elero::rf_task_func_(void *arg) {
       }
     }
 
-    // 4. Radio health check (only when idle, throttled internally to every 5s)
-    if (!tx_in_progress) {
+    // 6. Radio health check (only when idle, every RADIO_WATCHDOG_INTERVAL)
+    now = millis();
+    bool tx_idle = !tx_in_progress && !self->tx_burst_.active();
+    if (tx_idle && static_cast<int32_t>(now - next_health_ms) >= 0) {
+      next_health_ms = now + packet::timing::RADIO_WATCHDOG_INTERVAL;
       auto health = self->driver_->check_health();
       switch (health) {
         case RadioHealth::OK:
@@ -336,7 +429,7 @@ void Elero::rf_task_func_(void *arg) {
       }
     }
 
-    // 5. Stack watermark check (development aid, every 30s)
+    // 7. Stack watermark check (development aid, every 30s)
     now = millis();
     if (now - last_stack_check_ms > 30000) {
       last_stack_check_ms = now;
@@ -344,13 +437,25 @@ void Elero::rf_task_func_(void *arg) {
                static_cast<unsigned>(uxTaskGetStackHighWaterMark(nullptr) * sizeof(StackType_t)));
     }
 
-    // 6. Feed task watchdog (registered in setup)
+    // 8. Feed task watchdog (registered in setup)
     esp_task_wdt_reset();
 
-    // 7. Yield — sleep until ISR notification or 1ms timeout
-    //    This ensures Core 0 IDLE task runs (prevents TWDT) while keeping
-    //    the RF task responsive to both RX interrupts and TX requests.
-    ulTaskNotifyTake(pdTRUE, pdMS_TO_TICKS(1));
+    // 9. Sleep until ISR / tx_queue notification or the next deadline
+    //    (next burst packet, else health check). Pending work (more RX data,
+    //    queued TX while idle) shortens the sleep to one tick — never less:
+    //    a bare yield would spin Core 0 and starve lower-priority tasks,
+    //    including the IDLE task that feeds the watchdog.
+    bool work_pending = self->driver_->has_data() ||
+                        (tx_idle && uxQueueMessagesWaiting(self->tx_queue_handle_) > 0);
+    uint32_t deadline_ms = self->tx_burst_.active() ? self->tx_burst_.next_ms() : next_health_ms;
+    uint32_t sleep_ms = rf_task::sleep_ms(tx_in_progress, work_pending, millis(), deadline_ms);
+    TickType_t sleep_ticks = pdMS_TO_TICKS(sleep_ms);
+    int64_t sleep_start_us = esp_timer_get_time();
+    ulTaskNotifyTake(pdTRUE, sleep_ticks > 0 ? sleep_ticks : 1);
+    int64_t wake_us = esp_timer_get_time();
+    load.on_wake(static_cast<uint32_t>(wake_us - sleep_start_us), static_cast<uint32_t>(wake_us));
+    self->stat_rf_task_wakes_.store(load.wakes, std::memory_order_relaxed);
+    self->stat_rf_task_idle_pct_.store(load.idle_fraction * 100.0f, std::memory_order_relaxed);
   }
 }
 #endif
@@ -365,6 +470,7 @@ void Elero::reinit_frequency(uint8_t freq2, uint8_t freq1, uint8_t freq0) {
     ESP_LOGW(TAG, "Frequency change failed: tx_queue full");
     return;
   }
+  this->notify_rf_task_();
 
   // Update atomic copies for get_freq*() accessors (immediate visibility on Core 1)
   this->freq2_.store(freq2);
@@ -375,44 +481,35 @@ void Elero::reinit_frequency(uint8_t freq2, uint8_t freq1, uint8_t freq0) {
 }
 
 void Elero::build_tx_packet_(const EleroCommand &cmd) {
-  if (cmd.type == packet::msg_type::BUTTON && cmd.num_dests > 1) {
-    // Group 0x44: multi-dest button packet
-    packet::GroupButtonTxParams params;
-    params.counter = cmd.counter;
-    params.src_addr = cmd.src_addr;
-    params.command = cmd.payload[4];
-    params.type2 = cmd.type2;
-    params.hop = cmd.hop;
-    params.num_dests = cmd.num_dests;
-    params.dest_channels = cmd.dest_channels;
-    packet::build_group_button_packet(params, this->msg_tx_);
-  } else if (cmd.type == packet::msg_type::BUTTON) {
-    packet::ButtonTxParams params;
-    params.counter = cmd.counter;
-    params.src_addr = cmd.src_addr;
-    params.channel = cmd.channel;
-    params.command = cmd.payload[4];
-    params.type2 = cmd.type2;
-    params.hop = cmd.hop;
-    packet::build_button_packet(params, this->msg_tx_);
-  } else {
-    packet::TxParams params;
-    params.counter = cmd.counter;
-    params.dst_addr = cmd.dst_addr;
-    params.src_addr = cmd.src_addr;
-    params.channel = cmd.channel;
-    params.type = cmd.type;
-    params.type2 = cmd.type2;
-    params.hop = cmd.hop;
-    params.command = cmd.payload[4];
-    params.payload_1 = cmd.payload[0];
-    params.payload_2 = cmd.payload[1];
-    packet::build_tx_packet(params, this->msg_tx_);
-  }
+  (void) build_command_packet(cmd, this->msg_tx_);
 }
 
 bool Elero::request_tx(TxClient *client, const EleroCommand &cmd) {
+  RfTaskRequest req{};
+  req.type = RfTaskRequest::Type::TX;
+  req.cmd = cmd;
+  req.client = client;
+  return this->post_tx_request_(req);
+}
+
+bool Elero::request_tx_burst(TxClient *client, const EleroCommand &cmd, uint8_t packets, uint8_t gap_ms) {
+  RfTaskRequest req{};
+  req.type = RfTaskRequest::Type::TX_BURST;
+  req.burst_packets = packets;
+  req.burst_gap_ms = gap_ms;
+  req.cmd = cmd;
+  req.client = client;
+  return this->post_tx_request_(req);
+}
+
+void Elero::abort_tx(TxClient *client) {
+  this->tx_abort_.store(client, std::memory_order_release);
+  this->notify_rf_task_();
+}
+
+bool Elero::post_tx_request_(const RfTaskRequest &req) {
 #ifdef USE_ESP32
+  const EleroCommand &cmd = req.cmd;
   // Look up device name for TX intent log (runs on Core 1, no SPI)
   std::string blind_name;
   if (this->registry_) {
@@ -442,18 +539,17 @@ bool Elero::request_tx(TxClient *client, const EleroCommand &cmd) {
   }
 
   // Post to RF task queue (non-blocking, no SPI)
-  RfTaskRequest req{};
-  req.type = RfTaskRequest::Type::TX;
-  req.cmd = cmd;
-  req.client = client;
-  return xQueueSend(this->tx_queue_handle_, &req, 0) == pdPASS;
+  if (xQueueSend(this->tx_queue_handle_, &req, 0) != pdPASS)
+    return false;
+  this->notify_rf_task_();
+  return true;
 #else
   return false;
 #endif
 }
 
 // ─── decode_packet: fast path — pure decoding, no side effects ───────────────
-optional<RfPacketInfo> Elero::decode_packet(const uint8_t *buf, size_t buf_len) {
+bool Elero::decode_packet(const uint8_t *buf, size_t buf_len, RfPacketInfo &pkt) {
   using namespace packet;
 
   // Use the existing pure parse_packet() function
@@ -462,7 +558,7 @@ optional<RfPacketInfo> Elero::decode_packet(const uint8_t *buf, size_t buf_len)
     if (r.reject_reason) {
       ESP_LOGV(TAG, "Packet rejected: %s", r.reject_reason);
     }
-    return {};
+    return false;
   }
 
   // Extract fields relevant to this packet type
@@ -472,8 +568,7 @@ optional<RfPacketInfo> Elero::decode_packet(const uint8_t *buf, size_t buf_len)
   uint8_t command = (is_cmd || is_btn) ? r.payload[payload_offset::COMMAND] : 0;
   uint8_t state = is_status_pkt ? r.payload[payload_offset::STATE] : 0;
 
-  // Build RfPacketInfo
-  RfPacketInfo pkt{};
+  // Fill RfPacketInfo (every field — the ring slot holds a previous packet)
   pkt.timestamp_ms = millis();
   pkt.src = r.src_addr;
   pkt.dst = r.dst_addr;
@@ -492,12 +587,12 @@ optional<RfPacketInfo> Elero::decode_packet(const uint8_t *buf, size_t buf_len)
 #endif
   memcpy(pkt.payload, r.payload, sizeof(pkt.payload));
 
-  // Copy raw bytes for WebSocket broadcast
+  // Raw bytes are captured separately by decode_fifo_packets_() when wanted
   size_t raw_total = static_cast<size_t>(r.length) + PACKET_TOTAL_OVERHEAD;
   pkt.raw_len = (raw_total <= CC1101_FIFO_LENGTH) ? static_cast<uint8_t>(raw_total) : CC1101_FIFO_LENGTH;
-  memcpy(pkt.raw, buf, pkt.raw_len);
+  pkt.raw = nullptr;
 
-  return pkt;
+  return true;
 }
 
 // ─── dispatch_packet: slow path — logging, registry, sensors ─────────────────
@@ -616,6 +711,7 @@ bool Elero::send_raw_command(uint32_t dst_addr, uint32_t src_addr, uint8_t chann
   req.client = nullptr;  // No completion callback
 
   if (xQueueSend(this->tx_queue_handle_, &req, 0) == pdPASS) {
+    this->notify_rf_task_();
     ++raw_msg_cnt;
     if (raw_msg_cnt > packet::limits::COUNTER_MAX)
       raw_msg_cnt = 1;
@@ -645,6 +741,8 @@ void Elero::publish_stats_() {
     this->stats_rx_packets_->publish_state(this->stat_rx_packets_);
   if (this->stats_rx_drops_)
     this->stats_rx_drops_->publish_state(this->stat_rx_drops_.load(std::memory_order_relaxed));
+  if (this->stats_rx_high_water_)
+    this->stats_rx_high_water_->publish_state(this->rx_ring_.high_water());
   if (this->stats_fifo_overflows_)
     this->stats_fifo_overflows_->publish_state(this->stat_fifo_overflows_.load(std::memory_order_relaxed));
   if (this->stats_watchdog_)
@@ -653,8 +751,45 @@ void Elero::publish_stats_() {
     this->stats_dispatch_latency_->publish_state(this->stat_dispatch_latency_us_);
   if (this->stats_queue_transit_)
     this->stats_queue_transit_->publish_state(this->stat_queue_transit_us_);
+  if (this->stats_rf_task_wakes_)
+    this->stats_rf_task_wakes_->publish_state(this->stat_rf_task_wakes_.load(std::memory_order_relaxed));
+  if (this->stats_rf_task_idle_)
+    this->stats_rf_task_idle_->publish_state(this->stat_rf_task_idle_pct_.load(std::memory_order_relaxed));
   if (this->stats_last_rx_age_)
     this->stats_last_rx_age_->publish_state(this->stat_last_rx_ms_ > 0 ? static_cast<float>(now - this->stat_last_rx_ms_) : -1.0f);
+  if (this->registry_ != nullptr) {
+    const auto &polls = this->registry_->poll_scheduler();
+    if (this->stats_poll_rate_)
+      this->stats_poll_rate_->publish_state(polls.polls_per_minute());
+    if (this->stats_poll_missed_)
+      this->stats_poll_missed_->publish_state(polls.missed_total());
+    if (this->stats_poll_passive_)
+      this->stats_poll_passive_->publish_state(polls.passive_total());
+    if (this->stats_rf_occupancy_)
+      this->stats_rf_occupancy_->publish_state(polls.occupancy() * 100.0f);
+    const auto &tx = this->registry_->tx_scheduler();
+    if (this->stats_tx_delay_stop_)
+      this->stats_tx_delay_stop_->publish_state(tx.avg_delay_ms(TxClass::SAFETY));
+    if (this->stats_tx_delay_user_)
+      this->stats_tx_delay_user_->publish_state(tx.avg_delay_ms(TxClass::USER));
+    if (this->stats_tx_delay_check_)
+      this->stats_tx_delay_check_->publish_state(tx.avg_delay_ms(TxClass::FOLLOW_UP));
+    if (this->stats_tx_delay_poll_)
+      this->stats_tx_delay_poll_->publish_state(tx.avg_delay_ms(TxClass::BACKGROUND));
+    const auto &duty = this->registry_->duty_cycle();
+    if (this->stats_airtime_minute_)
+      this->stats_airtime_minute_->publish_state(duty.minute_us(now) / 1000.0f);
+    if (this->stats_airtime_hour_)
+      this->stats_airtime_hour_->publish_state(duty.hour_us(now) / 1000.0f);
+    if (this->stats_duty_cycle_remaining_)
+      this->stats_duty_cycle_remaining_->publish_state(100.0f * duty.hour_remaining_us(now) / duty.hour_budget_us());
+  }
+  if (this->stats_lbt_clear_)
+    this->stats_lbt_clear_->publish_state(this->stat_lbt_clear_.load(std::memory_order_relaxed));
+  if (this->stats_lbt_busy_)
+    this->stats_lbt_busy_->publish_state(this->stat_lbt_busy_.load(std::memory_order_relaxed));
+  if (this->stats_lbt_forced_)
+    this->stats_lbt_forced_->publish_state(this->stat_lbt_forced_.load(std::memory_order_relaxed));
 #endif
 }
 
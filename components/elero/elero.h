@@ -9,6 +9,9 @@
 #include "elero_packet.h"
 #include "elero_strings.h"
 #include "device_type.h"
+#include "spsc_ring.h"
+#include "rf_task_timing.h"
+#include "lbt.h"
 #include <string>
 #include <atomic>
 
@@ -35,38 +38,54 @@ class Sensor;
 
 namespace elero {
 
-/// Decoded RF packet info for WebSocket broadcast
+/// Raw on-air bytes of one received frame [length | data | RSSI | LQI|CRC_OK].
+/// Captured into a side ring only while an adapter wants raw frames.
+struct RfRawFrame {
+  uint8_t len;
+  uint8_t bytes[CC1101_FIFO_LENGTH];
+};
+
+/// Decoded RF packet info (hot RX ring item — keep small, no raw bytes inline).
+/// Fields ordered widest-first to avoid padding: 48 bytes on ESP32.
 struct RfPacketInfo {
-  uint32_t timestamp_ms;
   int64_t decoded_at_us{0};  ///< esp_timer_get_time() when decode completed (us, for latency tracking)
+  uint32_t timestamp_ms;
   uint32_t src;           ///< Source address (remote for commands, blind for status)
   uint32_t dst;           ///< Destination address (blind for commands, remote for status)
+  float rssi;
+  const RfRawFrame *raw{nullptr};  ///< Raw bytes in the capture ring, nullptr if not captured.
+                                   ///< Valid only during dispatch_packet().
   uint8_t channel;
   uint8_t type;           ///< Message type byte (0x6a=command, 0xca=status, etc.)
   uint8_t type2;          ///< Secondary type byte
   uint8_t command;        ///< Command byte (for command packets)
   uint8_t state;          ///< State byte (for status packets)
   uint8_t cnt;            ///< Rolling counter value from packet
-  float rssi;
   uint8_t lqi;            ///< Link Quality Indicator (0-127)
   bool crc_ok;            ///< CRC status from CC1101 appended byte
   uint8_t hop;
   uint8_t payload[10];
-  uint8_t raw_len;
-  uint8_t raw[CC1101_FIFO_LENGTH];
+  uint8_t raw_len;        ///< On-air length (length byte + data + 2 appended status bytes)
 };
 
 // String conversion declarations (elero_state_to_string, etc.) are in elero_strings.h
 
+/// RF task -> main loop RX ring depth (decoded packets in flight)
+constexpr size_t RX_RING_SIZE = 32;
+/// Raw frame capture ring depth (used only while raw capture is wanted)
+constexpr size_t RAW_RING_SIZE = 8;
+
 // ─── RF Task IPC Structs ─────────────────────────────────────────────────────
 
 /// Request from main loop -> RF task (via tx_queue).
 /// Uses a union to minimize queue item size (~50 bytes).
 struct RfTaskRequest {
-  enum class Type : uint8_t { TX, REINIT_FREQ } type;
-  TxClient *client{nullptr};  ///< TX: completion callback target (stable ptr on Device)
+  enum class Type : uint8_t { TX, TX_BURST, REINIT_FREQ } type;
+  uint8_t burst_packets{1};   ///< TX_BURST: number of identical packets (≤ TX_BURST_MAX_PACKETS)
+  uint8_t burst_gap_ms{0};    ///< TX_BURST: gap from end of one packet to start of the next
+  TxClient *client{nullptr};  ///< TX/TX_BURST: completion callback target (stable ptr on Device)
   union {
-    EleroCommand cmd;                            ///< TX: command to transmit
+    EleroCommand cmd;                            ///< TX/TX_BURST: command to transmit
     struct { uint8_t f2, f1, f0; } freq;         ///< REINIT_FREQ: new frequency registers
   };
 
@@ -77,6 +96,7 @@ struct RfTaskRequest {
 struct TxResult {
   TxClient *client{nullptr};  ///< nullptr for fire-and-forget (raw TX)
   bool success{false};
+  TxBurstReport burst{};      ///< TX_BURST: per-packet results (packets == 0 for single TX)
 };
 
 }  // namespace elero
@@ -107,6 +127,16 @@ class Elero : public Component {
   // Completion is notified asynchronously via TxClient::on_tx_complete() on Core 1.
   [[nodiscard]] bool request_tx(TxClient *client, const EleroCommand &cmd);
 
+  // Burst TX: the RF task sends @p packets copies of @p cmd, @p gap_ms apart,
+  // and reports once via TxClient::on_tx_burst_complete(). Same queueing rules
+  // as request_tx().
+  [[nodiscard]] bool request_tx_burst(TxClient *client, const EleroCommand &cmd, uint8_t packets, uint8_t gap_ms);
+
+  // The receiver acknowledged @p client's burst: the RF task sends no further
+  // repeats and reports only the packets that went out. Ignored if @p client's
+  // burst is no longer on air.
+  void abort_tx(TxClient *client);
+
   // Raw TX API (for WebSocket debugging/testing) — fire-and-forget via queue.
   [[nodiscard]] bool send_raw_command(uint32_t dst_addr, uint32_t src_addr, uint8_t channel,
                                       uint8_t command,
@@ -122,11 +152,28 @@ class Elero : public Component {
   void set_stats_tx_recover_sensor(sensor::Sensor *s) { stats_tx_recover_ = s; }
   void set_stats_rx_packets_sensor(sensor::Sensor *s) { stats_rx_packets_ = s; }
   void set_stats_rx_drops_sensor(sensor::Sensor *s) { stats_rx_drops_ = s; }
+  void set_stats_rx_high_water_sensor(sensor::Sensor *s) { stats_rx_high_water_ = s; }
   void set_stats_fifo_overflows_sensor(sensor::Sensor *s) { stats_fifo_overflows_ = s; }
   void set_stats_watchdog_sensor(sensor::Sensor *s) { stats_watchdog_ = s; }
   void set_stats_dispatch_latency_sensor(sensor::Sensor *s) { stats_dispatch_latency_ = s; }
   void set_stats_queue_transit_sensor(sensor::Sensor *s) { stats_queue_transit_ = s; }
   void set_stats_last_rx_age_sensor(sensor::Sensor *s) { stats_last_rx_age_ = s; }
+  void set_stats_rf_task_wakes_sensor(sensor::Sensor *s) { stats_rf_task_wakes_ = s; }
+  void set_stats_rf_task_idle_sensor(sensor::Sensor *s) { stats_rf_task_idle_ = s; }
+  void set_stats_poll_rate_sensor(sensor::Sensor *s) { stats_poll_rate_ = s; }
+  void set_stats_poll_missed_sensor(sensor::Sensor *s) { stats_poll_missed_ = s; }
+  void set_stats_poll_passive_sensor(sensor::Sensor *s) { stats_poll_passive_ = s; }
+  void set_stats_rf_occupancy_sensor(sensor::Sensor *s) { stats_rf_occupancy_ = s; }
+  void set_stats_tx_delay_stop_sensor(sensor::Sensor *s) { stats_tx_delay_stop_ = s; }
+  void set_stats_tx_delay_user_sensor(sensor::Sensor *s) { stats_tx_delay_user_ = s; }
+  void set_stats_tx_delay_check_sensor(sensor::Sensor *s) { stats_tx_delay_check_ = s; }
+  void set_stats_tx_delay_poll_sensor(sensor::Sensor *s) { stats_tx_delay_poll_ = s; }
+  void set_stats_lbt_clear_sensor(sensor::Sensor *s) { stats_lbt_clear_ = s; }
+  void set_stats_lbt_busy_sensor(sensor::Sensor *s) { stats_lbt_busy_ = s; }
+  void set_stats_lbt_forced_sensor(sensor::Sensor *s) { stats_lbt_forced_ = s; }
+  void set_stats_airtime_minute_sensor(sensor::Sensor *s) { stats_airtime_minute_ = s; }
+  void set_stats_airtime_hour_sensor(sensor::Sensor *s) { stats_airtime_hour_ = s; }
+  void set_stats_duty_cycle_remaining_sensor(sensor::Sensor *s) { stats_duty_cycle_remaining_ = s; }
 #endif
 
   // ── Radio driver ──────────────────────────────────────────────────────────
@@ -142,6 +189,10 @@ class Elero : public Component {
   void set_freq1(uint8_t freq) { freq1_.store(freq); }
   void set_freq2(uint8_t freq) { freq2_.store(freq); }
 
+  // Listen-before-talk (see lbt.h). Set before setup() — the RF task owns the gate afterwards.
+  void set_lbt_enabled(bool enabled) { lbt_.set_enabled(enabled); }
+  void set_lbt_threshold(int16_t dbm) { lbt_.set_busy_dbm(dbm); }
+
   void set_version(const char *version) { version_ = version; }
   const char *get_version() const { return version_; }
 
@@ -156,14 +207,20 @@ class Elero : public Component {
 
  private:
   // ─── Protocol-level methods (stay on Elero — not hardware) ─────────────────
-  [[nodiscard]] optional<RfPacketInfo> decode_packet(const uint8_t *buf, size_t buf_len);
+  /// Decode one packet from @p buf into @p pkt (an RX ring slot). Returns false if invalid.
+  [[nodiscard]] bool decode_packet(const uint8_t *buf, size_t buf_len, RfPacketInfo &pkt);
   void build_tx_packet_(const EleroCommand &cmd);  // Build packet in msg_tx_
+  bool post_tx_request_(const RfTaskRequest &req);  // Log TX intent, post to tx_queue, wake RF task
   void decode_fifo_packets_(size_t fifo_count);  // Parse multiple packets from FIFO buffer
 
   // ─── RF task entry point ───────────────────────────────────────────────────
 #ifdef USE_ESP32
   static void rf_task_func_(void *arg);
 #endif
+  /// Wake the RF task after posting to tx_queue (it otherwise sleeps until IRQ or deadline).
+  void notify_rf_task_();
+
+  std::atomic<TxClient *> tx_abort_{nullptr};  ///< Main loop→RF task: cut this owner's burst short
 
   // ─── ISR-shared state ──────────────────────────────────────────────────────
   std::atomic<bool> rx_ready_{false};   ///< ISR→RF task: RX packet available
@@ -171,9 +228,16 @@ class Elero : public Component {
 
   // ─── RF task-exclusive state (never accessed from main loop after setup) ───
   TxClient *tx_owner_{nullptr};        ///< Current TX owner (for completion callback)
+  TxBurst tx_burst_;                   ///< Repeat schedule of the current TX (single TX = burst of 1)
+  ListenBeforeTalk lbt_;               ///< Carrier sense before each packet
+  bool tx_burst_report_{false};        ///< Current TX came from TX_BURST (report per-packet results)
   uint8_t msg_rx_[CC1101_FIFO_LENGTH]; ///< RX FIFO buffer (RF task only)
   uint8_t msg_tx_[CC1101_FIFO_LENGTH]; ///< TX packet buffer (RF task only)
 
+  // ─── RF task -> main loop RX rings (RF task produces, main loop consumes) ──
+  SpscRing<RfPacketInfo, RX_RING_SIZE> rx_ring_;
+  SpscRing<RfRawFrame, RAW_RING_SIZE> raw_ring_;  ///< Parallel to rx_ring_ for packets with raw != nullptr
+
   // ─── Atomic state (written by RF task, read by main loop) ──────────────────
   std::atomic<uint8_t> freq0_{defaults::FREQ0};
   std::atomic<uint8_t> freq1_{defaults::FREQ1};
@@ -194,6 +258,12 @@ class Elero : public Component {
   std::atomic<uint32_t> stat_rx_drops_{0};
   std::atomic<uint32_t> stat_fifo_overflows_{0};
   std::atomic<uint32_t> stat_watchdog_recoveries_{0};
+  std::atomic<uint32_t> stat_rf_task_wakes_{0};
+  std::atomic<float> stat_rf_task_idle_pct_{0.0f};   ///< % of last 10 s window the RF task slept
+  std::atomic<uint32_t> stat_lbt_clear_{0};          ///< Copies of lbt_ counters
+  std::atomic<uint32_t> stat_lbt_busy_{0};
+  std::atomic<uint32_t> stat_lbt_forced_{0};
+  std::atomic<uint32_t> stat_airtime_us_{0};         ///< Running sum of our own TX airtime (wraps)
 
   // Core 1 only (incremented and read on main loop)
   uint32_t stat_tx_success_{0};
@@ -203,6 +273,7 @@ class Elero : public Component {
   float stat_dispatch_latency_us_{0};
   float stat_queue_transit_us_{0};
   uint32_t last_stats_publish_ms_{0};
+  uint32_t airtime_seen_us_{0};  ///< stat_airtime_us_ already handed to the registry
 
   void publish_stats_();
 
@@ -213,17 +284,33 @@ class Elero : public Component {
   sensor::Sensor *stats_tx_recover_{nullptr};
   sensor::Sensor *stats_rx_packets_{nullptr};
   sensor::Sensor *stats_rx_drops_{nullptr};
+  sensor::Sensor *stats_rx_high_water_{nullptr};
   sensor::Sensor *stats_fifo_overflows_{nullptr};
   sensor::Sensor *stats_watchdog_{nullptr};
   sensor::Sensor *stats_dispatch_latency_{nullptr};
   sensor::Sensor *stats_queue_transit_{nullptr};
   sensor::Sensor *stats_last_rx_age_{nullptr};
+  sensor::Sensor *stats_rf_task_wakes_{nullptr};
+  sensor::Sensor *stats_rf_task_idle_{nullptr};
+  sensor::Sensor *stats_poll_rate_{nullptr};
+  sensor::Sensor *stats_poll_missed_{nullptr};
+  sensor::Sensor *stats_poll_passive_{nullptr};
+  sensor::Sensor *stats_rf_occupancy_{nullptr};
+  sensor::Sensor *stats_tx_delay_stop_{nullptr};
+  sensor::Sensor *stats_tx_delay_user_{nullptr};
+  sensor::Sensor *stats_tx_delay_check_{nullptr};
+  sensor::Sensor *stats_tx_delay_poll_{nullptr};
+  sensor::Sensor *stats_lbt_clear_{nullptr};
+  sensor::Sensor *stats_lbt_busy_{nullptr};
+  sensor::Sensor *stats_lbt_forced_{nullptr};
+  sensor::Sensor *stats_airtime_minute_{nullptr};
+  sensor::Sensor *stats_airtime_hour_{nullptr};
+  sensor::Sensor *stats_duty_cycle_remaining_{nullptr};
 #endif
 
   // ─── FreeRTOS IPC (cross-core communication) ──────────────────────────────
 #ifdef USE_ESP32
   TaskHandle_t rf_task_handle_{nullptr};
-  QueueHandle_t rx_queue_handle_{nullptr};       ///< RF task -> main loop: RfPacketInfo
   QueueHandle_t tx_queue_handle_{nullptr};       ///< Main loop -> RF task: RfTaskRequest
   QueueHandle_t tx_done_queue_handle_{nullptr};  ///< RF task -> main loop: TxResult
 #endif
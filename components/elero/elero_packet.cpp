@@ -115,6 +115,69 @@ ParseResult parse_packet(const uint8_t* raw, size_t raw_len) {
   return r;
 }
 
+// ─── Encrypted payload cache ────────────────────────────────────────────────
+
+namespace {
+
+/// Plaintext layout: [crypto_hi, crypto_lo, command, cmd2, 0, 0, state, parity]
+constexpr void fill_plain_payload(uint8_t *enc, uint8_t counter, uint8_t command, uint8_t state) {
+  uint16_t code = calc_crypto_code(counter);
+  enc[payload_offset::CRYPTO_HIGH] = (code >> 8) & 0xFF;
+  enc[payload_offset::CRYPTO_LOW] = code & 0xFF;
+  enc[payload_offset::COMMAND] = command;
+  enc[payload_offset::COMMAND2] = 0;   // secondary command (unused)
+  enc[4] = 0;                          // padding
+  enc[5] = 0;                          // padding
+  enc[payload_offset::STATE] = state;  // state (status packets only)
+  enc[payload_offset::PARITY] = 0;     // parity (set by msg_encode)
+}
+
+constexpr int command_index(uint8_t command) {
+  for (size_t i = 0; i < payload_cache::NUM_COMMANDS; ++i) {
+    if (payload_cache::COMMANDS[i] == command) return static_cast<int>(i);
+  }
+  return -1;
+}
+
+struct PayloadCacheTable {
+  uint8_t block[payload_cache::NUM_COMMANDS][payload_cache::NUM_COUNTERS][payload_cache::BLOCK_SIZE];
+};
+
+constexpr PayloadCacheTable make_payload_cache() {
+  PayloadCacheTable t{};
+  for (size_t c = 0; c < payload_cache::NUM_COMMANDS; ++c) {
+    for (size_t n = 0; n < payload_cache::NUM_COUNTERS; ++n) {
+      uint8_t *enc = t.block[c][n];
+      fill_plain_payload(enc, static_cast<uint8_t>(n), payload_cache::COMMANDS[c], 0);
+      protocol::msg_encode(enc);
+    }
+  }
+  return t;
+}
+
+constexpr PayloadCacheTable PAYLOAD_CACHE = make_payload_cache();
+static_assert(sizeof(PAYLOAD_CACHE) == payload_cache::FLASH_BYTES, "payload cache must be densely packed");
+
+}  // namespace
+
+const uint8_t *payload_cache::lookup(uint8_t counter, uint8_t command) {
+  int idx = command_index(command);
+  if (idx < 0) return nullptr;
+  return PAYLOAD_CACHE.block[idx][counter];
+}
+
+void write_encrypted_payload(uint8_t *enc, uint8_t counter, uint8_t command, uint8_t state) {
+  if (state == 0) {
+    const uint8_t *cached = payload_cache::lookup(counter, command);
+    if (cached != nullptr) {
+      memcpy(enc, cached, payload_cache::BLOCK_SIZE);
+      return;
+    }
+  }
+  fill_plain_payload(enc, counter, command, state);
+  protocol::msg_encode(enc);
+}
+
 size_t build_tx_packet(const TxParams& params, uint8_t* out_buf) {
   // Clear buffer
   memset(out_buf, 0, TX_MSG_LENGTH + 1);
@@ -141,21 +204,8 @@ size_t build_tx_packet(const TxParams& params, uint8_t* out_buf) {
   out_buf[tx_offset::PAYLOAD] = params.payload_1;
   out_buf[tx_offset::PAYLOAD + 1] = params.payload_2;
 
-  // Build encrypted section at offset 22 using payload_offset layout:
-  // [crypto_hi, crypto_lo, command, cmd2, 0, 0, state, parity]
-  uint8_t *enc = &out_buf[tx_offset::CRYPTO_CODE];
-  uint16_t code = calc_crypto_code(params.counter);
-  enc[payload_offset::CRYPTO_HIGH] = (code >> 8) & 0xFF;
-  enc[payload_offset::CRYPTO_LOW] = code & 0xFF;
-  enc[payload_offset::COMMAND] = params.command;
-  enc[payload_offset::COMMAND2] = 0;   // secondary command (unused)
-  enc[4] = 0;                          // padding
-  enc[5] = 0;                          // padding
-  enc[payload_offset::STATE] = 0;      // state (unused for TX)
-  enc[payload_offset::PARITY] = 0;     // parity (set by msg_encode)
-
-  // Encrypt the 8-byte section in-place
-  protocol::msg_encode(enc);
+  // Encrypted section at offset 22
+  write_encrypted_payload(&out_buf[tx_offset::CRYPTO_CODE], params.counter, params.command, params.state);
 
   return TX_MSG_LENGTH + 1;
 }
@@ -185,20 +235,8 @@ size_t build_button_packet(const ButtonTxParams& params, uint8_t* out_buf) {
   out_buf[btn_offset::ZERO_BYTE] = 0x00;
   out_buf[btn_offset::FIXED_03] = 0x03;
 
-  // Build encrypted section at offset 20
-  uint8_t *enc = &out_buf[btn_offset::CRYPTO_CODE];
-  uint16_t code = calc_crypto_code(params.counter);
-  enc[payload_offset::CRYPTO_HIGH] = (code >> 8) & 0xFF;
-  enc[payload_offset::CRYPTO_LOW] = code & 0xFF;
-  enc[payload_offset::COMMAND] = params.command;
-  enc[payload_offset::COMMAND2] = 0;
-  enc[4] = 0;
-  enc[5] = 0;
-  enc[payload_offset::STATE] = 0;
-  enc[payload_offset::PARITY] = 0;
-
-  // Encrypt the 8-byte section in-place
-  protocol::msg_encode(enc);
+  // Encrypted section at offset 20
+  write_encrypted_payload(&out_buf[btn_offset::CRYPTO_CODE], params.counter, params.command);
 
   return button::MSG_LENGTH + 1;
 }
@@ -245,19 +283,7 @@ size_t build_group_button_packet(const GroupButtonTxParams& params, uint8_t* out
   out_buf[payload_start + 1] = defaults::PAYLOAD_2;  // 0x04
 
   // Encrypted section (8 bytes, immediately after payload_1/payload_2)
-  uint8_t *enc = &out_buf[payload_start + 2];
-  uint16_t code = calc_crypto_code(params.counter);
-  enc[payload_offset::CRYPTO_HIGH] = (code >> 8) & 0xFF;
-  enc[payload_offset::CRYPTO_LOW] = code & 0xFF;
-  enc[payload_offset::COMMAND] = params.command;
-  enc[payload_offset::COMMAND2] = 0;
-  enc[4] = 0;
-  enc[5] = 0;
-  enc[payload_offset::STATE] = 0;
-  enc[payload_offset::PARITY] = 0;
-
-  // Encrypt the 8-byte section in-place
-  protocol::msg_encode(enc);
+  write_encrypted_payload(&out_buf[payload_start + 2], params.counter, params.command);
 
   return static_cast<size_t>(packet_length) + 1;
 }
@@ -346,3 +372,45 @@ CoverStateResult map_cover_state(uint8_t elero_state) {
 }
 
 }  // namespace esphome::elero::packet
+
+namespace esphome::elero {
+
+size_t build_command_packet(const EleroCommand &cmd, uint8_t *out_buf) {
+  using namespace packet;
+  if (cmd.type == msg_type::BUTTON && cmd.num_dests > 1) {
+    // Group 0x44: multi-dest button packet
+    GroupButtonTxParams params;
+    params.counter = cmd.counter;
+    params.src_addr = cmd.src_addr;
+    params.command = cmd.payload[4];
+    params.type2 = cmd.type2;
+    params.hop = cmd.hop;
+    params.num_dests = cmd.num_dests;
+    params.dest_channels = cmd.dest_channels;
+    return build_group_button_packet(params, out_buf);
+  }
+  if (cmd.type == msg_type::BUTTON) {
+    ButtonTxParams params;
+    params.counter = cmd.counter;
+    params.src_addr = cmd.src_addr;
+    params.channel = cmd.channel;
+    params.command = cmd.payload[4];
+    params.type2 = cmd.type2;
+    params.hop = cmd.hop;
+    return build_button_packet(params, out_buf);
+  }
+  TxParams params;
+  params.counter = cmd.counter;
+  params.dst_addr = cmd.dst_addr;
+  params.src_addr = cmd.src_addr;
+  params.channel = cmd.channel;
+  params.type = cmd.type;
+  params.type2 = cmd.type2;
+  params.hop = cmd.hop;
+  params.command = cmd.payload[4];
+  params.payload_1 = cmd.payload[0];
+  params.payload_2 = cmd.payload[1];
+  return build_tx_packet(params, out_buf);
+}
+
+}  // namespace esphome::elero
@@ -143,7 +143,6 @@ namespace timing {
 constexpr uint32_t POLL_INTERVAL_MOVING = 2000;   ///< Poll every 2s while moving
 constexpr uint32_t DELAY_SEND_PACKETS = 50;       ///< 50ms between targeted packet repeats
 constexpr uint32_t TIMEOUT_MOVEMENT = 120000;     ///< Max 2min movement timeout
-constexpr uint32_t POLL_OFFSET_SPACING = 5000;    ///< 5s spacing between blind polls
 constexpr uint32_t TX_PENDING_TIMEOUT = 500;      ///< TX completion timeout
 constexpr uint32_t RADIO_WATCHDOG_INTERVAL = 5000; ///< Radio health check every 5s
 constexpr uint32_t PUBLISH_THROTTLE_MS = 1000;    ///< Throttle state publishes during movement/dimming
@@ -151,6 +150,8 @@ constexpr uint32_t DEFAULT_POLL_INTERVAL_MS = 300000;  ///< Default poll interva
 constexpr uint32_t MAX_BACKOFF_MS = 400;          ///< Maximum TX retry backoff delay
 constexpr uint32_t POST_STOP_COOLDOWN_MS = 3000;  ///< Ignore RF "still moving" after STOP for 3s
 constexpr uint32_t RESPONSE_WAIT_MS = 2000;        ///< Wait for blind response before polling
+constexpr uint32_t COALESCE_WINDOW_MS = 40;       ///< Merge same-command cover TX into group packets
+constexpr uint32_t SNAPSHOT_BUCKET_MS = 50;       ///< Memoized state snapshots are reused within one bucket
 }  // namespace timing
 
 // ═══════════════════════════════════════════════════════════════════════════════
@@ -276,6 +277,30 @@ inline bool is_button_packet(uint8_t type) {
   return type == msg_type::BUTTON;
 }
 
+/// Check if a cover's status shows that a command took effect.
+/// Further repeats of the command, and a CHECK to confirm it, are then redundant.
+/// @param cmd Command byte sent to the cover
+/// @param state_byte State byte of the cover's status reply
+/// @return true if the state is the command's result (any state answers a CHECK)
+constexpr bool status_acknowledges(uint8_t cmd, uint8_t state_byte) {
+  switch (cmd) {
+    case command::CHECK:
+      return true;
+    case command::UP:
+      return state_byte == state::START_MOVING_UP || state_byte == state::MOVING_UP || state_byte == state::TOP ||
+             state_byte == state::TOP_TILT;
+    case command::DOWN:
+      return state_byte == state::START_MOVING_DOWN || state_byte == state::MOVING_DOWN ||
+             state_byte == state::BOTTOM || state_byte == state::BOTTOM_TILT;
+    case command::STOP:
+      return state_byte == state::STOPPED || state_byte == state::INTERMEDIATE || state_byte == state::TOP ||
+             state_byte == state::BOTTOM;
+    case command::TILT:
+      return state_byte == state::TILT || state_byte == state::TOP_TILT || state_byte == state::BOTTOM_TILT;
+  }
+  return false;
+}
+
 // ─── Main Parse Function ────────────────────────────────────────────────────
 
 /// Parse a raw RF packet from the CC1101 FIFO.
@@ -380,6 +405,7 @@ struct TxParams {
   uint8_t command{command::CHECK};          ///< Command byte
   uint8_t payload_1{defaults::PAYLOAD_1};   ///< Payload byte at offset 20
   uint8_t payload_2{defaults::PAYLOAD_2};   ///< Payload byte at offset 21
+  uint8_t state{state::UNKNOWN};            ///< State byte (0xCA status packets only, 0 for commands)
 };
 
 /// Write a 24-bit address in big-endian format.
@@ -394,10 +420,39 @@ inline void write_addr(uint8_t* buf, uint32_t addr) {
 /// Calculate the rolling code XOR bytes from the counter.
 /// @param counter Rolling message counter
 /// @return 16-bit code (high byte first)
-inline uint16_t calc_crypto_code(uint8_t counter) {
+constexpr uint16_t calc_crypto_code(uint8_t counter) {
   return (0x0000 - (static_cast<uint32_t>(counter) * TX_CRYPTO_MULT)) & TX_CRYPTO_MASK;
 }
 
+// ─── Encrypted Payload Cache ────────────────────────────────────────────────
+
+/// Precomputed encrypted sections for every (counter, command) pair sent by
+/// the hub. A command's 8-byte block depends only on the counter (crypto code)
+/// and the command byte, so TX building is a memcpy instead of msg_encode().
+///
+/// Generated at compile time into .rodata: 6 commands x 256 counters x 8 bytes
+/// = 12 KiB flash, 0 bytes RAM. button::RELEASE is 0x00 and shares the CHECK row.
+namespace payload_cache {
+constexpr uint8_t COMMANDS[] = {command::CHECK, command::STOP, command::UP,
+                                command::TILT, command::DOWN, command::INTERMEDIATE};
+constexpr size_t NUM_COMMANDS = sizeof(COMMANDS);
+constexpr size_t NUM_COUNTERS = 256;
+constexpr size_t BLOCK_SIZE = 8;
+constexpr size_t FLASH_BYTES = NUM_COMMANDS * NUM_COUNTERS * BLOCK_SIZE;
+
+/// Encrypted block for (counter, command) with state byte 0.
+/// @return Pointer to 8 bytes in flash, or nullptr if the command is not cached
+const uint8_t *lookup(uint8_t counter, uint8_t command);
+}  // namespace payload_cache
+
+/// Fill the 8-byte encrypted section of a TX packet.
+/// Uses payload_cache for command packets (state 0), otherwise encodes in place.
+/// @param enc Destination (8 bytes)
+/// @param counter Rolling message counter
+/// @param command Command byte
+/// @param state State byte (0xCA status packets only)
+void write_encrypted_payload(uint8_t *enc, uint8_t counter, uint8_t command, uint8_t state = 0);
+
 /// Build a TX packet from command parameters.
 ///
 /// @param params Command parameters
@@ -507,4 +562,12 @@ struct EleroCommand {
   uint8_t dest_channels[packet::GROUP_MAX_DESTS]{};        ///< Channel IDs for group TX
 };
 
+/// Build the on-air packet for a TX command into out_buf.
+/// Selects the builder from cmd.type/num_dests: group 0x44, single 0x44, or targeted 0x6A.
+/// Shared by the RF task and the host-side radio simulator so both emit identical bytes.
+/// @param cmd Command to encode (payload[4] = command byte)
+/// @param out_buf Output buffer (must be at least FIFO_LENGTH bytes)
+/// @return Packet length including length byte, or 0 if validation fails
+size_t build_command_packet(const EleroCommand &cmd, uint8_t *out_buf);
+
 }  // namespace esphome::elero
@@ -1,5 +1,7 @@
 #pragma once
 
+#include <array>
+#include <bit>
 #include <cstdint>
 
 /// @file elero_protocol.h
@@ -33,30 +35,68 @@ constexpr uint8_t ENCODE_TABLE[] = {0x08, 0x02, 0x0d, 0x01, 0x0f, 0x0e, 0x07, 0x
 constexpr uint8_t DECODE_TABLE[] = {0x0a, 0x03, 0x01, 0x0c, 0x0d, 0x07, 0x0f, 0x06,
                                     0x00, 0x08, 0x0b, 0x0e, 0x09, 0x02, 0x05, 0x04};
 
+namespace detail {
+
+/// Expand a 16-entry nibble table to 256 entries (both nibbles in one lookup).
+constexpr std::array<uint8_t, 256> make_byte_table(const uint8_t (&nibble)[16]) {
+  std::array<uint8_t, 256> table{};
+  for (int i = 0; i < 256; ++i) {
+    table[i] = static_cast<uint8_t>((nibble[i >> 4] << 4) | nibble[i & 0x0F]);
+  }
+  return table;
+}
+
+/// r20 value for each byte position: FE, DC, BA, ... (decrement 0x22 per byte).
+/// Encoding runs it across all 8 bytes; decoding restarts at R20_SECOND for byte 2,
+/// which is the same value, so one schedule serves both directions.
+constexpr std::array<uint8_t, 8> make_r20_schedule() {
+  std::array<uint8_t, 8> schedule{};
+  uint8_t r20 = crypto_local::R20_INITIAL;
+  for (auto &r : schedule) {
+    r = r20;
+    r20 = static_cast<uint8_t>(r20 - crypto_local::R20_DECREMENT);
+  }
+  return schedule;
+}
+
+}  // namespace detail
+
+/// Byte-wide versions of ENCODE_TABLE/DECODE_TABLE (256 bytes each, in flash).
+inline constexpr std::array<uint8_t, 256> ENCODE_BYTE_TABLE = detail::make_byte_table(ENCODE_TABLE);
+inline constexpr std::array<uint8_t, 256> DECODE_BYTE_TABLE = detail::make_byte_table(DECODE_TABLE);
+
+/// Per-position r20 values used by msg_encode()/msg_decode().
+inline constexpr std::array<uint8_t, 8> R20_SCHEDULE = detail::make_r20_schedule();
+static_assert(R20_SCHEDULE[2] == crypto_local::R20_SECOND, "decode r20 restart must match schedule");
+
 /// Count number of set bits in a byte, return parity (0 or 1).
-inline uint8_t count_bits(uint8_t byte) {
-  uint8_t ones = 0;
-  uint8_t mask = 1;
-  for (uint8_t i = 0; i < 8; ++i) {
-    if (mask & byte) {
-      ++ones;
-    }
-    mask <<= 1;
+constexpr uint8_t count_bits(uint8_t byte) {
+  return static_cast<uint8_t>(std::popcount(byte) & 0x01);
+}
+
+/// Parity byte for an 8-byte message: bit (7 - i) is the parity of msg[2i] ^ msg[2i+1].
+constexpr uint8_t parity_byte(const uint8_t *msg) {
+  uint8_t p = 0;
+  for (uint8_t i = 0; i < 4; ++i) {
+    p |= count_bits(msg[i * 2] ^ msg[i * 2 + 1]) << (7 - i);
   }
-  return ones & 0x01;
+  return p;
 }
 
 /// Calculate parity byte for an 8-byte message.
 /// Stores result in msg[7].
 inline void calc_parity(uint8_t *msg) {
-  uint8_t p = 0;
-  for (uint8_t i = 0; i < 4; ++i) {
-    uint8_t a = count_bits(msg[0 + i * 2]);
-    uint8_t b = count_bits(msg[1 + i * 2]);
-    p |= a ^ b;
-    p <<= 1;
-  }
-  msg[7] = (p << 3);
+  msg[7] = parity_byte(msg);
+}
+
+/// Add r20 to each nibble of one byte (carry does not cross nibbles).
+constexpr uint8_t add_r20_nibble(uint8_t d, uint8_t r20) {
+  return static_cast<uint8_t>((((d & 0xF0) + (r20 & 0xF0)) & 0xF0) | ((d + r20) & 0x0F));
+}
+
+/// Subtract r20 from each nibble of one byte (borrow does not cross nibbles).
+constexpr uint8_t sub_r20_nibble(uint8_t d, uint8_t r20) {
+  return static_cast<uint8_t>((((d & 0xF0) - (r20 & 0xF0)) & 0xF0) | ((d - r20) & 0x0F));
 }
 
 /// Add r20 value to nibbles (encoding step).
@@ -120,23 +160,37 @@ inline void decode_nibbles(uint8_t *msg, uint8_t len) {
 }
 
 /// Decode an 8-byte Elero payload message.
+///
+/// Single pass, equivalent to: decode_nibbles → sub_r20_from_nibbles(FE, 0..2)
+/// → xor_2byte_in_array_decode(msg[0], msg[1]) → sub_r20_from_nibbles(BA, 2..8).
+/// Bytes 0-1 only yield the XOR key and decode to zero.
 /// @param msg Pointer to 8-byte buffer (modified in place)
-inline void msg_decode(uint8_t *msg) {
-  decode_nibbles(msg, 8);
-  sub_r20_from_nibbles(msg, crypto_local::R20_INITIAL, 0, 2);
-  xor_2byte_in_array_decode(msg, msg[0], msg[1]);
-  sub_r20_from_nibbles(msg, crypto_local::R20_SECOND, 2, 8);
+constexpr void msg_decode(uint8_t *msg) {
+  const uint8_t xor0 = sub_r20_nibble(DECODE_BYTE_TABLE[msg[0]], R20_SCHEDULE[0]);
+  const uint8_t xor1 = sub_r20_nibble(DECODE_BYTE_TABLE[msg[1]], R20_SCHEDULE[1]);
+  msg[0] = 0;
+  msg[1] = 0;
+  for (uint8_t i = 2; i < 8; i += 2) {
+    msg[i] = sub_r20_nibble(DECODE_BYTE_TABLE[msg[i]] ^ xor0, R20_SCHEDULE[i]);
+    msg[i + 1] = sub_r20_nibble(DECODE_BYTE_TABLE[msg[i + 1]] ^ xor1, R20_SCHEDULE[i + 1]);
+  }
 }
 
 /// Encode an 8-byte Elero payload message.
+///
+/// Single pass, equivalent to: calc_parity → add_r20_to_nibbles(FE, 0..8)
+/// → xor_2byte_in_array_encode(original msg[0], msg[1]) → encode_nibbles.
 /// @param msg Pointer to 8-byte buffer (modified in place)
-inline void msg_encode(uint8_t *msg) {
-  uint8_t xor0 = msg[0];
-  uint8_t xor1 = msg[1];
-  calc_parity(msg);
-  add_r20_to_nibbles(msg, crypto_local::R20_INITIAL, 0, 8);
-  xor_2byte_in_array_encode(msg, xor0, xor1);
-  encode_nibbles(msg);
+constexpr void msg_encode(uint8_t *msg) {
+  const uint8_t xor0 = msg[0];
+  const uint8_t xor1 = msg[1];
+  msg[7] = parity_byte(msg);
+  msg[0] = ENCODE_BYTE_TABLE[add_r20_nibble(msg[0], R20_SCHEDULE[0])];
+  msg[1] = ENCODE_BYTE_TABLE[add_r20_nibble(msg[1], R20_SCHEDULE[1])];
+  for (uint8_t i = 2; i < 8; i += 2) {
+    msg[i] = ENCODE_BYTE_TABLE[add_r20_nibble(msg[i], R20_SCHEDULE[i]) ^ xor0];
+    msg[i + 1] = ENCODE_BYTE_TABLE[add_r20_nibble(msg[i + 1], R20_SCHEDULE[i + 1]) ^ xor1];
+  }
 }
 
 }  // namespace protocol
@@ -0,0 +1,81 @@
+#pragma once
+
+/// @file lbt.h
+/// @brief Listen-before-talk gate for the RF task — pure logic, no FreeRTOS deps.
+///
+/// Before loading a packet into the radio, the RF task samples the channel
+/// RSSI (RadioDriver::sample_rssi()). At or above the busy threshold someone
+/// else is on the air — most often a blind answering our previous packet —
+/// and the packet waits a short random backoff instead of colliding with it.
+/// The CC1101's hardware CCA only covers that chip; SX1262/SX1276 had no
+/// gating at all. This gate works the same on every radio.
+///
+/// Deferral is bounded: after MAX_DEFER_MS of busy samples the packet goes
+/// out anyway, so a stuck carrier (or a jammer) cannot block TX forever.
+
+#include <cstdint>
+
+namespace esphome {
+namespace elero {
+
+namespace lbt {
+constexpr int16_t DEFAULT_BUSY_DBM = -90;  ///< Channel busy at or above this RSSI
+constexpr uint32_t BACKOFF_MIN_MS = 2;     ///< Shortest deferral
+constexpr uint32_t BACKOFF_JITTER_MS = 6;  ///< Random extra 0..JITTER-1 ms (about one frame's airtime)
+constexpr uint32_t MAX_DEFER_MS = 50;      ///< Transmit anyway after deferring this long
+}  // namespace lbt
+
+/// Gate state and counters, owned by the RF task.
+class ListenBeforeTalk {
+ public:
+  void set_enabled(bool enabled) { this->enabled_ = enabled; }
+  void set_busy_dbm(int16_t dbm) { this->busy_dbm_ = dbm; }
+  [[nodiscard]] bool enabled() const { return this->enabled_; }
+  [[nodiscard]] int16_t busy_dbm() const { return this->busy_dbm_; }
+
+  /// Gate the packet that is due at @p now.
+  /// @param sampled  The radio sampled @p rssi_dbm (false: TX goes ungated)
+  /// @param rssi_dbm Channel RSSI right now
+  /// @param random   Any random value, for the backoff jitter
+  /// @return ms to wait before checking again; 0 = transmit now
+  uint32_t check(bool sampled, int16_t rssi_dbm, uint32_t now, uint32_t random) {
+    if (!this->enabled_ || !sampled) {
+      this->deferring_ = false;
+      return 0;
+    }
+    if (rssi_dbm < this->busy_dbm_) {
+      ++this->clear_total_;
+      this->deferring_ = false;
+      return 0;
+    }
+    if (!this->deferring_) {
+      this->deferring_ = true;
+      this->defer_start_ms_ = now;
+    } else if ((now - this->defer_start_ms_) >= lbt::MAX_DEFER_MS) {
+      ++this->forced_total_;
+      this->deferring_ = false;
+      return 0;
+    }
+    ++this->busy_total_;
+    return lbt::BACKOFF_MIN_MS + random % lbt::BACKOFF_JITTER_MS;
+  }
+
+  /// Packets sent after a clear sample.
+  [[nodiscard]] uint32_t clear_total() const { return this->clear_total_; }
+  /// Busy samples, each costing one backoff.
+  [[nodiscard]] uint32_t busy_total() const { return this->busy_total_; }
+  /// Packets sent on a busy channel after MAX_DEFER_MS.
+  [[nodiscard]] uint32_t forced_total() const { return this->forced_total_; }
+
+ private:
+  bool enabled_{true};
+  int16_t busy_dbm_{lbt::DEFAULT_BUSY_DBM};
+  bool deferring_{false};
+  uint32_t defer_start_ms_{0};
+  uint32_t clear_total_{0};
+  uint32_t busy_total_{0};
+  uint32_t forced_total_{0};
+};
+
+}  // namespace elero
+}  // namespace esphome
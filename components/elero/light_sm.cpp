@@ -43,6 +43,23 @@ bool supports_brightness(const Context &ctx) {
     return ctx.dim_duration_ms > 0;
 }
 
+bool tick_deadline(const State &state, const Context &ctx, uint32_t &at) {
+    auto dim_end = [&](uint32_t start_ms, float distance) {
+        float span = distance - BRIGHTNESS_EPSILON;
+        at = start_ms;
+        if (span > 0.0f && ctx.dim_duration_ms > 0) {
+            at += static_cast<uint32_t>(std::ceil(span * static_cast<float>(ctx.dim_duration_ms)));
+        }
+        return true;
+    };
+    return std::visit(overloaded{
+        [](const Off &) { return false; },
+        [](const On &) { return false; },
+        [&](const DimmingUp &s) { return dim_end(s.start_ms, s.target_brightness - s.start_brightness); },
+        [&](const DimmingDown &s) { return dim_end(s.start_ms, s.start_brightness - s.target_brightness); },
+    }, state);
+}
+
 // ─── RF Status transitions ─────────────────────────────────────────────────
 
 State on_rf_status(const State &state, uint8_t state_byte, uint32_t now,
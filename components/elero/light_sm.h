@@ -64,6 +64,11 @@ bool supports_brightness(const Context &ctx);
 /// Tolerance for brightness comparisons.
 constexpr float BRIGHTNESS_EPSILON = 0.01f;
 
+/// When on_tick() will end the current dim (brightness within
+/// BRIGHTNESS_EPSILON of the target).
+/// @return false if not dimming
+bool tick_deadline(const State &state, const Context &ctx, uint32_t &at);
+
 // ═══════════════════════════════════════════════════════════════════════════════
 // TRANSITIONS
 // ═══════════════════════════════════════════════════════════════════════════════
@@ -0,0 +1,133 @@
+/// @file link_quality.h
+/// @brief Per-device link statistics and the TX parameters learned from them.
+///
+/// Every cover and light gets the same repeat count, retry limit and retry
+/// backoff out of the box. LinkQuality tracks how the link to one device
+/// actually behaves — smoothed RSSI of its STATUS frames, share of poll CHECKs
+/// it answers, retries its commands needed — and derives that device's
+/// parameters from it:
+///
+///   strong link (close, answers every poll, no retries)  → MIN_REPEATS
+///   unremarkable link / too few observations             → defaults
+///   each weak indicator (low RSSI, missed polls, retries) → +1 repeat,
+///                                                            +1 retry, longer backoff
+///
+/// All parameters stay within fixed bounds, so a bad estimate costs at most a
+/// little airtime or a little reliability.
+///
+/// Pure logic, no ESPHome deps. Fixed-size, no heap.
+
+#pragma once
+
+#include <cstdint>
+#include "elero_packet.h"
+
+namespace esphome::elero {
+
+namespace link_q {
+constexpr float EWMA_ALPHA = 0.125f;       ///< Weight of a new observation
+constexpr uint8_t MIN_SAMPLES = 8;         ///< Defaults until this many observations
+constexpr float STRONG_RSSI_DBM = -70.0f;  ///< At or above: close to the gateway
+constexpr float WEAK_RSSI_DBM = -90.0f;    ///< Below: edge of range
+constexpr float GOOD_RESPONSE = 0.95f;     ///< Poll answer rate of a strong link
+constexpr float POOR_RESPONSE = 0.75f;     ///< Below: polls get lost
+constexpr float LOW_RETRIES = 0.05f;       ///< Mean retries per command of a strong link
+constexpr float HIGH_RETRIES = 0.5f;       ///< Above: commands need retries
+constexpr uint8_t MIN_REPEATS = 2;         ///< Never fewer repeats than this
+constexpr uint8_t MAX_REPEATS = 5;         ///< Never more repeats than this
+constexpr uint8_t MAX_RETRIES = 5;         ///< Never more retries than this
+constexpr uint8_t MAX_BACKOFF_SHIFT = 2;   ///< Retry backoff grows up to 4×
+}  // namespace link_q
+
+/// TX parameters for one device.
+struct LinkParams {
+    uint8_t repeats{packet::button::PACKETS};          ///< Packets per command
+    uint8_t max_retries{packet::limits::SEND_RETRIES};  ///< Failed TX attempts before dropping
+    uint8_t backoff_shift{0};                           ///< Added to the retry backoff exponent
+};
+
+class LinkQuality {
+ public:
+    /// Off: params() stays at the defaults; statistics are still tracked.
+    void set_adaptive(bool adaptive) {
+        adaptive_ = adaptive;
+        update_();
+    }
+
+    /// RSSI of a frame received from the device.
+    void on_rssi(float rssi) {
+        rssi_ = has_rssi_ ? ewma_(rssi_, rssi) : rssi;
+        has_rssi_ = true;
+        observed_();
+    }
+
+    /// A poll CHECK was answered / went unanswered for RESPONSE_WAIT_MS.
+    void on_check_answered() { on_check_(1.0f); }
+    void on_check_missed() { on_check_(0.0f); }
+
+    /// A command went out after @p retries failed attempts (dropped ones
+    /// count as max_retries + 1).
+    void on_command_done(uint8_t retries) {
+        retries_ = has_retries_ ? ewma_(retries_, static_cast<float>(retries)) : static_cast<float>(retries);
+        has_retries_ = true;
+        observed_();
+    }
+
+    [[nodiscard]] const LinkParams &params() const { return params_; }
+    [[nodiscard]] bool learned() const { return samples_ >= link_q::MIN_SAMPLES; }
+    [[nodiscard]] bool has_rssi() const { return has_rssi_; }
+    [[nodiscard]] float rssi() const { return rssi_; }
+    /// Smoothed share of poll CHECKs answered (1.0 until one was observed).
+    [[nodiscard]] float response_rate() const { return has_response_ ? response_ : 1.0f; }
+    /// Smoothed retries per command (0.0 until one was observed).
+    [[nodiscard]] float retries() const { return has_retries_ ? retries_ : 0.0f; }
+
+ private:
+    static float ewma_(float avg, float sample) { return avg + link_q::EWMA_ALPHA * (sample - avg); }
+
+    void on_check_(float answered) {
+        response_ = has_response_ ? ewma_(response_, answered) : answered;
+        has_response_ = true;
+        observed_();
+    }
+
+    void observed_() {
+        if (samples_ < link_q::MIN_SAMPLES) ++samples_;
+        update_();
+    }
+
+    void update_() {
+        params_ = LinkParams{};
+        if (!adaptive_ || !learned()) return;
+
+        // Indicators without observations count as unremarkable
+        uint8_t weak = 0;
+        if (has_rssi_ && rssi_ < link_q::WEAK_RSSI_DBM) ++weak;
+        if (response_rate() < link_q::POOR_RESPONSE) ++weak;
+        if (retries() > link_q::HIGH_RETRIES) ++weak;
+
+        if (weak == 0) {
+            bool strong = has_rssi_ && rssi_ >= link_q::STRONG_RSSI_DBM &&
+                          response_rate() >= link_q::GOOD_RESPONSE && retries() <= link_q::LOW_RETRIES;
+            if (strong) params_.repeats = link_q::MIN_REPEATS;
+            return;
+        }
+        params_.repeats = clamp_(packet::button::PACKETS + weak, link_q::MAX_REPEATS);
+        params_.max_retries = clamp_(packet::limits::SEND_RETRIES + weak, link_q::MAX_RETRIES);
+        params_.backoff_shift = clamp_(weak, link_q::MAX_BACKOFF_SHIFT);
+    }
+
+    static uint8_t clamp_(unsigned v, uint8_t max) { return static_cast<uint8_t>(v > max ? max : v); }
+
+    LinkParams params_{};
+    bool adaptive_{true};
+    uint8_t samples_{0};
+    bool has_rssi_{false};
+    bool has_response_{false};
+    bool has_retries_{false};
+    float rssi_{0.0f};
+    float response_{1.0f};
+    float retries_{0.0f};
+};
+
+}  // namespace esphome::elero
@@ -12,6 +12,7 @@
 #pragma once
 
 #include "device.h"
+#include <span>
 
 namespace esphome::elero {
 
@@ -19,6 +20,30 @@ struct RfPacketInfo;  // Forward declaration (defined in elero.h)
 
 class DeviceRegistry;  // Forward declaration
 
+/// What an adapter consumes. The registry skips adapters that are not
+/// interested before doing any per-adapter work (virtual call, JSON, publish).
+struct AdapterInterest {
+    uint16_t changes{0xFFFF};    ///< state_change:: flags it publishes (state events)
+    uint8_t device_types{0xFF};  ///< type_bit() per DeviceType it publishes state for
+    bool rf_packets{true};       ///< on_rf_packet()
+    bool device_events{true};    ///< on_device_added/removed(), on_config_changed()
+
+    static constexpr uint8_t type_bit(DeviceType type) { return static_cast<uint8_t>(1u << static_cast<uint8_t>(type)); }
+
+    /// Interested in nothing (e.g. no connected client).
+    static constexpr AdapterInterest none() { return {0, 0, false, false}; }
+
+    [[nodiscard]] constexpr bool wants_state(DeviceType type, uint16_t changed) const {
+        return (device_types & type_bit(type)) != 0 && (changes & changed) != 0;
+    }
+};
+
+/// One device's accumulated changes in a state batch.
+struct StateChange {
+    const Device *device;
+    uint16_t changes;  ///< state_change:: flags
+};
+
 class OutputAdapter {
  public:
     virtual ~OutputAdapter() = default;
@@ -30,6 +55,10 @@ class OutputAdapter {
     /// Called every ESPHome loop iteration.
     virtual void loop() = 0;
 
+    /// Events this adapter wants. Read when the adapter is added and again on
+    /// DeviceRegistry::refresh_interest() — call that when it changes.
+    [[nodiscard]] virtual AdapterInterest interest() const { return {}; }
+
     /// A device was added to the registry (activated from NVS or CRUD).
     virtual void on_device_added(const Device &dev) = 0;
 
@@ -40,6 +69,13 @@ class OutputAdapter {
     /// @param changes Bitmask of state_change:: flags indicating which fields changed.
     virtual void on_state_changed(const Device &dev, uint16_t changes) = 0;
 
+    /// Every device that changed during one registry loop iteration, once
+    /// each and in slot order. Override to publish many devices in one
+    /// message; the default forwards each entry to on_state_changed().
+    virtual void on_state_batch(std::span<const StateChange> batch) {
+        for (const auto &c : batch) on_state_changed(*c.device, c.changes);
+    }
+
     /// A device's config was updated (CRUD update, not state change).
     virtual void on_config_changed(const Device &dev) {}
 
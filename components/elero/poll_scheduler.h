@@ -0,0 +1,200 @@
+/// @file poll_scheduler.h
+/// @brief Hub-wide CHECK scheduler — airtime budget, priorities, occupancy backoff.
+///
+/// Each cover's PollTimer still decides *whether* it wants a status poll. The
+/// scheduler decides *when* the CHECK goes on air: at most one poll exchange
+/// (CHECK + STATUS reply) per gap, where the gap keeps polls within a fixed
+/// share of airtime. Requests are granted moving covers first, then recently
+/// commanded ones, then oldest first — so a burst of user commands can no
+/// longer line up every cover's 2 s moving poll in the same instant.
+///
+/// Measured RF occupancy (airtime of every received frame) widens the gap
+/// while the channel is busy and narrows it again once it quiets down.
+///
+/// Pure logic, no ESPHome deps. Fixed-size, no heap.
+
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+namespace esphome::elero {
+
+namespace poll_sched {
+/// One poll exchange (0x6a CHECK out + 0xca STATUS back) at the drivers'
+/// ~76.8 kBaud, until the hub sets the radio's own figure.
+constexpr uint32_t DEFAULT_EXCHANGE_AIRTIME_MS = 10;
+constexpr float DEFAULT_BUDGET = 0.10f;         ///< Share of airtime for polls
+constexpr uint32_t RECENT_COMMAND_MS = 30000;   ///< "Recently commanded" priority window
+constexpr uint32_t OCCUPANCY_WINDOW_MS = 10000; ///< Occupancy measurement window
+constexpr float BUSY_OCCUPANCY = 0.30f;         ///< Back off above this channel occupancy
+constexpr float QUIET_OCCUPANCY = 0.15f;        ///< Recover below this
+constexpr uint8_t MAX_BACKOFF_SHIFT = 4;        ///< Gap grows up to 16×
+constexpr uint32_t RATE_WINDOW_MS = 60000;      ///< Poll rate metric window
+}  // namespace poll_sched
+
+enum class PollPriority : uint8_t {
+    MOVING = 0,          ///< Cover moving — position estimate needs confirmation
+    RECENT_COMMAND = 1,  ///< Commanded within RECENT_COMMAND_MS (incl. post-stop verification)
+    ROUTINE = 2,         ///< Periodic idle poll
+};
+
+template<size_t N>
+class PollScheduler {
+ public:
+    /// Share of airtime polls may use (0 < fraction ≤ 1).
+    void set_budget(float fraction) {
+        if (fraction > 0.0f && fraction <= 1.0f) budget_ = fraction;
+    }
+
+    /// Airtime of one poll exchange, from the radio's bitrate (0 is ignored).
+    void set_exchange_airtime_ms(uint32_t ms) {
+        if (ms > 0) exchange_airtime_ms_ = ms;
+    }
+    [[nodiscard]] uint32_t exchange_airtime_ms() const { return exchange_airtime_ms_; }
+
+    /// Queue a CHECK for @p id. A pending request keeps its age and is only
+    /// upgraded, never downgraded, in priority.
+    void request(uint8_t id, PollPriority prio, uint32_t now) {
+        if (id >= N) return;
+        auto &p = pending_[id];
+        if (!p.queued) {
+            p = {true, prio, now};
+            ++count_;
+        } else if (prio < p.prio) {
+            p.prio = prio;
+        }
+    }
+
+    void cancel(uint8_t id) {
+        if (id >= N || !pending_[id].queued) return;
+        pending_[id].queued = false;
+        --count_;
+    }
+
+    [[nodiscard]] bool pending(uint8_t id) const { return id < N && pending_[id].queued; }
+    [[nodiscard]] size_t pending_count() const { return count_; }
+
+    /// Minimum spacing between granted polls at the current backoff.
+    [[nodiscard]] uint32_t gap_ms() const {
+        auto gap = static_cast<uint32_t>(static_cast<float>(exchange_airtime_ms_) / budget_);
+        return gap << backoff_shift_;
+    }
+
+    /// millis() at which the next poll may be granted.
+    [[nodiscard]] uint32_t next_grant_ms() const { return granted_any_ ? last_grant_ms_ + gap_ms() : 0; }
+
+    /// Take the best pending request if the budget allows a poll at @p now.
+    /// The caller sends the CHECK and must call on_granted(). Requests below
+    /// @p lowest stay pending (duty-cycle deferral).
+    bool take(uint32_t now, uint8_t &id, PollPriority *prio = nullptr, PollPriority lowest = PollPriority::ROUTINE) {
+        if (count_ == 0) return false;
+        if (granted_any_ && (now - last_grant_ms_) < gap_ms()) return false;
+        size_t best = N;
+        for (size_t i = 0; i < N; ++i) {
+            const auto &p = pending_[i];
+            if (!p.queued || p.prio > lowest) continue;
+            if (best == N || p.prio < pending_[best].prio ||
+                (p.prio == pending_[best].prio &&
+                 static_cast<int32_t>(p.since - pending_[best].since) < 0)) {
+                best = i;
+            }
+        }
+        if (best == N) return false;
+        id = static_cast<uint8_t>(best);
+        if (prio != nullptr) *prio = pending_[best].prio;
+        cancel(id);
+        return true;
+    }
+
+    /// A granted CHECK was handed to the device's sender.
+    void on_granted(uint32_t now) {
+        last_grant_ms_ = now;
+        granted_any_ = true;
+        ++polls_total_;
+        ++rate_polls_;
+        roll_(now);
+    }
+
+    /// A polled device did not answer within RESPONSE_WAIT_MS (lost on air —
+    /// usually a collision).
+    void on_missed() { ++missed_total_; }
+
+    /// A STATUS refreshed a cover without any request of ours in flight
+    /// (reply to a physical remote or another gateway) — a poll saved.
+    void on_passive_refresh() { ++passive_total_; }
+
+    /// Account @p airtime_ms of observed channel activity ending at @p now.
+    void on_air(uint32_t now, uint32_t airtime_ms) {
+        roll_(now);
+        occupancy_air_ms_ += airtime_ms;
+    }
+
+    /// Close finished measurement windows. Call once per loop.
+    void update(uint32_t now) { roll_(now); }
+
+    // ─── Metrics ───
+    [[nodiscard]] uint32_t polls_total() const { return polls_total_; }
+    [[nodiscard]] uint32_t missed_total() const { return missed_total_; }
+    [[nodiscard]] uint32_t passive_total() const { return passive_total_; }
+    [[nodiscard]] float polls_per_minute() const { return polls_per_minute_; }
+    [[nodiscard]] float occupancy() const { return occupancy_; }
+    [[nodiscard]] uint8_t backoff_shift() const { return backoff_shift_; }
+
+ private:
+    struct Pending {
+        bool queued{false};
+        PollPriority prio{PollPriority::ROUTINE};
+        uint32_t since{0};
+    };
+
+    void roll_(uint32_t now) {
+        if (!started_) {
+            started_ = true;
+            occupancy_start_ms_ = now;
+            rate_start_ms_ = now;
+            return;
+        }
+        uint32_t elapsed = now - occupancy_start_ms_;
+        if (elapsed >= poll_sched::OCCUPANCY_WINDOW_MS) {
+            occupancy_ = static_cast<float>(occupancy_air_ms_) / static_cast<float>(elapsed);
+            if (occupancy_ > 1.0f) occupancy_ = 1.0f;
+            if (occupancy_ > poll_sched::BUSY_OCCUPANCY && backoff_shift_ < poll_sched::MAX_BACKOFF_SHIFT) {
+                ++backoff_shift_;
+            } else if (occupancy_ < poll_sched::QUIET_OCCUPANCY && backoff_shift_ > 0) {
+                --backoff_shift_;
+            }
+            occupancy_air_ms_ = 0;
+            occupancy_start_ms_ = now;
+        }
+        uint32_t rate_elapsed = now - rate_start_ms_;
+        if (rate_elapsed >= poll_sched::RATE_WINDOW_MS) {
+            polls_per_minute_ = static_cast<float>(rate_polls_) * 60000.0f / static_cast<float>(rate_elapsed);
+            rate_polls_ = 0;
+            rate_start_ms_ = now;
+        }
+    }
+
+    std::array<Pending, N> pending_{};
+    size_t count_{0};
+    float budget_{poll_sched::DEFAULT_BUDGET};
+    uint32_t exchange_airtime_ms_{poll_sched::DEFAULT_EXCHANGE_AIRTIME_MS};
+    uint8_t backoff_shift_{0};
+    bool granted_any_{false};
+    uint32_t last_grant_ms_{0};
+
+    bool started_{false};
+    uint32_t occupancy_start_ms_{0};
+    uint32_t occupancy_air_ms_{0};
+    float occupancy_{0.0f};
+    uint32_t rate_start_ms_{0};
+    uint32_t rate_polls_{0};
+    float polls_per_minute_{0.0f};
+
+    uint32_t polls_total_{0};
+    uint32_t missed_total_{0};
+    uint32_t passive_total_{0};
+};
+
+}  // namespace esphome::elero
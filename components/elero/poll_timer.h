@@ -4,8 +4,10 @@
 /// Matches the old CoverCore::should_poll / mark_polled behavior:
 /// - Boolean `awaiting_response` cleared on RF response, not by timeout
 /// - Timeout clears awaiting flag, falls through to normal interval check
-/// - Staggered offset for first poll per cover
+/// - Offset for first poll per cover (spreading is done hub-wide by PollScheduler)
 /// - Fast polling while moving (2s)
+/// - Any STATUS from the blind counts as a poll, whoever asked for it
+/// - A remote command seen on air earns one follow-up CHECK
 
 #pragma once
 
@@ -20,9 +22,15 @@ struct PollTimer {
     uint32_t last_poll_ms{0};
     uint32_t last_command_ms{0};        ///< When we last sent a command/CHECK
     bool     awaiting_response{false};  ///< Waiting for blind to respond
+    bool     check_outstanding{false};  ///< A CHECK was sent and not answered yet
+    bool     followup_pending{false};   ///< Remote command observed, no STATUS seen since
+    uint32_t followup_at_ms{0};         ///< When the follow-up CHECK becomes due
 
-    /// Check if it's time to poll.
-    /// Mirrors old CoverCore::should_poll() exactly.
+    /// Whether this cover wants a status poll at @p now: once the response
+    /// wait after a command is over and the (moving or idle) interval has
+    /// elapsed since the last poll — the first one not before offset_ms — or
+    /// when the follow-up CHECK for an overheard remote command is due.
+    /// Only a request: the hub-wide PollScheduler decides when it goes on air.
     bool should_poll(uint32_t now, bool is_moving) {
         // Response-wait: defer polling after command TX to keep radio in RX
         if (awaiting_response) {
@@ -45,6 +53,11 @@ struct PollTimer {
             return false;
         }
 
+        // Remote command observed and the blind's reply was not overheard
+        if (followup_pending && static_cast<int32_t>(now - followup_at_ms) >= 0) {
+            return true;
+        }
+
         // First poll uses offset for staggering
         if (last_poll_ms == 0) {
             return now >= offset_ms;
@@ -53,12 +66,45 @@ struct PollTimer {
         return (now - last_poll_ms) >= effective_interval;
     }
 
+    /// When should_poll() can next return true (absolute millis()).
+    /// While awaiting a response this is the end of the response wait, at
+    /// which point should_poll() re-evaluates the interval.
+    /// @return false if polling is disabled (interval 0)
+    bool next_due(bool is_moving, uint32_t &at) const {
+        if (awaiting_response) {
+            at = last_command_ms + packet::timing::RESPONSE_WAIT_MS;
+            return true;
+        }
+        uint32_t effective_interval = is_moving
+            ? packet::timing::POLL_INTERVAL_MOVING
+            : interval_ms;
+        if (effective_interval == 0) {
+            return false;
+        }
+        at = (last_poll_ms == 0) ? offset_ms : last_poll_ms + effective_interval;
+        if (followup_pending && static_cast<int32_t>(followup_at_ms - at) < 0) {
+            at = followup_at_ms;
+        }
+        return true;
+    }
+
     /// Mark that a poll (CHECK) was just sent.
     /// Sets awaiting_response so we stay in RX until blind responds or timeout.
     void on_poll_sent(uint32_t now) {
         last_poll_ms = now;
         last_command_ms = now;
         awaiting_response = true;
+        check_outstanding = true;
+        followup_pending = false;
+    }
+
+    /// True once per CHECK that went unanswered for RESPONSE_WAIT_MS.
+    bool take_missed_check(uint32_t now) {
+        if (!check_outstanding || (now - last_poll_ms) < packet::timing::RESPONSE_WAIT_MS) {
+            return false;
+        }
+        check_outstanding = false;
+        return true;
     }
 
     /// Mark that a user command was just sent (suppresses polls briefly).
@@ -67,11 +113,24 @@ struct PollTimer {
         awaiting_response = true;
     }
 
+    /// Mark that a command for this blind from another sender (physical
+    /// remote, other gateway) was seen on air. The blind usually answers that
+    /// sender directly; if we don't overhear the reply within RESPONSE_WAIT_MS,
+    /// one CHECK is due. Ignored while our own exchange is in flight.
+    void on_remote_command(uint32_t now) {
+        if (awaiting_response) return;
+        followup_pending = true;
+        followup_at_ms = now + packet::timing::RESPONSE_WAIT_MS;
+    }
+
     /// Mark that an RF response was received.
+    /// Any STATUS counts — replies to our CHECKs as well as to other senders.
     /// Clears awaiting_response so we fall back to interval-based polling.
     void on_rf_received(uint32_t now) {
         last_poll_ms = now;
         awaiting_response = false;
+        check_outstanding = false;
+        followup_pending = false;
     }
 };
 
@@ -14,6 +14,18 @@
 namespace esphome {
 namespace elero {
 
+/// On-air framing shared by every driver (CC1101 MDMCFG1/SYNC_MODE/PKTCTRL0,
+/// mirrored by the SX drivers): 12 preamble bytes, 4 sync bytes, 2 CRC bytes
+/// around [length | data].
+constexpr uint32_t FRAME_OVERHEAD_BYTES = 12 + 4 + 2;
+
+/// On-air duration of a frame of @p len bytes (length byte + data) at
+/// @p bitrate_bps, rounded up.
+constexpr uint32_t frame_airtime_us(size_t len, uint32_t bitrate_bps) {
+  uint64_t bits = static_cast<uint64_t>(FRAME_OVERHEAD_BYTES + len) * 8;
+  return static_cast<uint32_t>((bits * 1000000 + bitrate_bps - 1) / bitrate_bps);
+}
+
 /// Current radio mode — tracks the half-duplex state.
 /// Callers can assert mode before RX/TX operations.
 enum class RadioMode : uint8_t {
@@ -101,6 +113,12 @@ class RadioDriver {
   /// @return Number of bytes read (0 on overflow or empty FIFO)
   virtual size_t read_fifo(uint8_t *buf, size_t max_len) = 0;
 
+  /// Sample the channel RSSI right now, for listen-before-talk (see lbt.h).
+  /// Only meaningful in RX mode.
+  /// @param dbm Output: instantaneous RSSI in dBm
+  /// @return false if the radio cannot sample (TX then goes ungated)
+  virtual bool sample_rssi([[maybe_unused]] int16_t &dbm) { return false; }
+
   // ── Health ─────────────────────────────────────────────────────────────────
 
   /// Check radio health (periodic watchdog).
@@ -124,6 +142,13 @@ class RadioDriver {
   /// Radio chip identifier (e.g., "cc1101", "sx1262") for UI/config events.
   virtual const char *radio_name() const = 0;
 
+  /// On-air bitrate as configured by init().
+  virtual uint32_t bitrate_bps() const = 0;
+
+  /// On-air duration of a packet of @p len bytes (length byte + data),
+  /// rounded up. Used for duty-cycle accounting (see duty_cycle.h).
+  uint32_t airtime_us(size_t len) const { return frame_airtime_us(len, this->bitrate_bps()); }
+
   /// Receiver sensitivity in dBm (e.g., -104 for CC1101, -117 for SX1262).
   /// Used by the UI to derive signal strength thresholds.
   virtual int rx_sensitivity_dbm() const = 0;
@@ -0,0 +1,75 @@
+#pragma once
+
+/// @file rf_task_timing.h
+/// @brief RF task sleep scheduling and idle accounting — pure logic, no FreeRTOS deps.
+///
+/// The RF task blocks in ulTaskNotifyTake() until something needs it:
+///   - the radio IRQ (RX packet or TX done) — ISR notifies the task
+///   - a new request on tx_queue — request_tx()/send_raw_command()/reinit_frequency() notify
+///   - a computed deadline: TX fallback polling while a TX is in flight,
+///     the next packet of a TX burst, the next radio health check, and a
+///     maximum sleep that keeps the task watchdog fed.
+/// Everything else (the former 1 ms tick) was wasted wake-ups.
+
+#include <cstdint>
+
+namespace esphome {
+namespace elero {
+namespace rf_task {
+
+constexpr uint32_t TX_POLL_MS = 1;          ///< Fallback poll while a TX is in flight (IRQ may be missed)
+constexpr uint32_t MAX_SLEEP_MS = 1000;     ///< Upper bound: keeps the task WDT (5 s) fed
+constexpr uint32_t LOAD_WINDOW_US = 10000000;  ///< Idle fraction is computed over 10 s windows
+
+/// How long the RF task may block before its next pass. 0 means "no reason
+/// to wait"; the task still blocks for one tick so it never spins.
+/// @param tx_in_progress Radio is transmitting (poll_tx() needs fallback polling)
+/// @param work_pending   Work already queued (more RX data or TX requests)
+/// @param now            Current millis()
+/// @param next_deadline_ms millis() of the next timed job: the next burst
+///                         packet (see tx_burst.h), else check_health()
+constexpr uint32_t sleep_ms(bool tx_in_progress, bool work_pending, uint32_t now, uint32_t next_deadline_ms) {
+  if (work_pending)
+    return 0;
+  if (tx_in_progress)
+    return TX_POLL_MS;
+  int32_t until_deadline = static_cast<int32_t>(next_deadline_ms - now);
+  if (until_deadline <= 0)
+    return 0;
+  return static_cast<uint32_t>(until_deadline) < MAX_SLEEP_MS ? static_cast<uint32_t>(until_deadline) : MAX_SLEEP_MS;
+}
+
+/// Wake counter and idle fraction of the RF task. Owned by the RF task;
+/// results are copied to atomics for the main loop.
+struct LoadMeter {
+  uint32_t wakes{0};             ///< Total wake-ups since boot
+  float idle_fraction{0.0f};     ///< Share of the last complete window spent blocked (0..1)
+
+  /// Record one blocking wait. @p slept_us is the time spent blocked,
+  /// @p now_us the timestamp after waking (wraps every ~71 min, handled).
+  void on_wake(uint32_t slept_us, uint32_t now_us) {
+    this->wakes++;
+    this->idle_us_ += slept_us;
+    uint32_t elapsed = now_us - this->window_start_us_;
+    if (!this->started_) {
+      this->started_ = true;
+      this->window_start_us_ = now_us - slept_us;
+      return;
+    }
+    if (elapsed >= LOAD_WINDOW_US) {
+      float f = static_cast<float>(this->idle_us_) / static_cast<float>(elapsed);
+      this->idle_fraction = f > 1.0f ? 1.0f : f;
+      this->idle_us_ = 0;
+      this->window_start_us_ = now_us;
+    }
+  }
+
+ private:
+  bool started_{false};
+  uint32_t window_start_us_{0};
+  uint32_t idle_us_{0};
+};
+
+}  // namespace rf_task
+}  // namespace elero
+}  // namespace esphome
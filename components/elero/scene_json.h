@@ -0,0 +1,65 @@
+#pragma once
+
+/// @file scene_json.h
+/// @brief JSON form of DeviceRegistry::apply_scene() — shared by WebSocket and MQTT.
+///
+/// Request:
+///   {"covers": [{"address": "0xa831e5", "position": 50},
+///               {"address": "0xb912f0", "action": "close"}]}
+/// Each cover gives either a position (0–100 %) or an action
+/// (open/up, close/down, stop, tilt). Unknown addresses count as skipped.
+///
+/// Result:
+///   {"applied": 2, "skipped": 0, "packets": 1, "completion_ms": 18500}
+
+#include "device_registry.h"
+#include "elero_strings.h"
+#include "esphome/components/json/json_util.h"
+#include <array>
+#include <cstdlib>
+
+namespace esphome {
+namespace elero {
+
+/// Parse the "covers" array of @p root and apply it as one scene.
+inline SceneResult apply_scene_json(DeviceRegistry &registry, JsonObject root) {
+  std::array<SceneEntry, DeviceRegistry::MAX_DEVICES> entries{};
+  size_t n = 0;
+  uint16_t dropped = 0;
+
+  for (JsonObject cover : root["covers"].as<JsonArray>()) {
+    if (n >= entries.size()) {
+      ++dropped;
+      continue;
+    }
+    SceneEntry &e = entries[n++];
+    uint32_t addr = 0;
+    if (cover["address"].is<const char *>()) {
+      addr = (uint32_t) strtoul(cover["address"].as<const char *>(), nullptr, 0);
+    } else {
+      addr = cover["address"] | 0u;
+    }
+    e.device = registry.find(addr, DeviceType::COVER);
+    if (cover["position"].is<float>()) {
+      e.position = cover["position"].as<float>() / PERCENT_SCALE;
+    } else {
+      e.command = elero_action_to_command(cover["action"] | "");
+    }
+  }
+
+  SceneResult result = registry.apply_scene(std::span<const SceneEntry>(entries.data(), n));
+  result.skipped += dropped;
+  return result;
+}
+
+inline std::string scene_result_json(const SceneResult &result) {
+  return json::build_json([&](JsonObject root) {
+    root["applied"] = result.applied;
+    root["skipped"] = result.skipped;
+    root["packets"] = result.packets;
+    root["completion_ms"] = result.completion_ms;
+  });
+}
+
+}  // namespace elero
+}  // namespace esphome
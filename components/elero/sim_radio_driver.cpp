@@ -0,0 +1,339 @@
+/// @file sim_radio_driver.cpp
+/// @brief Host-side virtual radio implementation (not built for ESP32 firmware).
+
+#ifndef USE_ESP32
+
+#include "sim_radio_driver.h"
+#include "time_provider.h"
+#include <cmath>
+
+namespace esphome {
+namespace elero {
+
+using namespace packet;
+
+uint8_t sim_rssi_raw(float rssi_dbm) {
+  float raw = (rssi_dbm - RSSI_OFFSET) * RSSI_DIVISOR;
+  if (raw > 127.0f)
+    raw = 127.0f;
+  if (raw < -128.0f)
+    raw = -128.0f;
+  return static_cast<uint8_t>(static_cast<int8_t>(std::lround(raw)));
+}
+
+// ─── SimMedium ─────────────────────────────────────────────────────────────
+
+SimMedium::SimMedium(const SimMediumConfig &config) : config_(config), rng_state_(config.seed ? config.seed : 1) {}
+
+uint32_t SimMedium::airtime_ms(size_t len) const {
+  // Preamble + sync + [length | data] + CRC, 8 bits per byte, rounded up
+  uint64_t bits = static_cast<uint64_t>(sim::PREAMBLE_BYTES + sim::SYNC_BYTES + len + sim::CRC_BYTES) * 8;
+  uint32_t bps = this->config_.bitrate_bps ? this->config_.bitrate_bps : sim::BITRATE_BPS;
+  return static_cast<uint32_t>((bits * 1000 + bps - 1) / bps);
+}
+
+uint32_t SimMedium::transmit(const SimNode *from, const uint8_t *pkt, size_t len) {
+  uint32_t now = get_time_provider().millis();
+  Frame f{from, std::vector<uint8_t>(pkt, pkt + len), now, now + this->airtime_ms(len), false};
+
+  if (this->config_.collisions) {
+    for (auto &other : this->in_flight_) {
+      if (other.from == from)
+        continue;
+      if (other.start_ms < f.end_ms && f.start_ms < other.end_ms) {
+        if (!other.collided)
+          this->stats_.frames_collided++;
+        other.collided = true;
+        f.collided = true;
+      }
+    }
+    if (f.collided)
+      this->stats_.frames_collided++;
+  }
+
+  this->stats_.frames_sent++;
+  this->stats_.airtime_ms += f.end_ms - f.start_ms;
+  uint32_t end = f.end_ms;
+  this->in_flight_.push_back(std::move(f));
+  return end;
+}
+
+bool SimMedium::busy(uint32_t now) const {
+  for (const auto &f : this->in_flight_) {
+    if (f.start_ms <= now && now < f.end_ms)
+      return true;
+  }
+  return false;
+}
+
+float SimMedium::rssi_dbm(uint32_t now, const SimNode *listener) const {
+  float rssi = sim::NOISE_FLOOR_DBM;
+  for (const auto &f : this->in_flight_) {
+    if (f.from != listener && f.start_ms <= now && now < f.end_ms && f.from->rssi_dbm > rssi)
+      rssi = f.from->rssi_dbm;
+  }
+  return rssi;
+}
+
+uint32_t SimMedium::next_random_() {
+  // xorshift32 — deterministic per seed, good enough for loss dice
+  uint32_t x = this->rng_state_;
+  x ^= x << 13;
+  x ^= x >> 17;
+  x ^= x << 5;
+  this->rng_state_ = x;
+  return x;
+}
+
+void SimMedium::update() {
+  uint32_t now = get_time_provider().millis();
+
+  // Frames are appended in start order; deliver from the front while due.
+  // A frame stays in flight until delivery so later overlapping TX can still
+  // mark it as collided.
+  while (!this->in_flight_.empty()) {
+    Frame &f = this->in_flight_.front();
+    if (static_cast<int32_t>(now - (f.end_ms + this->config_.latency_ms)) < 0)
+      break;
+
+    if (!f.collided) {
+      // Hub format: [length | data | RSSI | LQI|CRC_OK]
+      uint8_t rx[FIFO_LENGTH + CC1101_APPEND_SIZE];
+      size_t n = f.bytes.size() < FIFO_LENGTH ? f.bytes.size() : FIFO_LENGTH;
+      std::copy(f.bytes.begin(), f.bytes.begin() + n, rx);
+      rx[n] = sim_rssi_raw(f.from->rssi_dbm);
+      rx[n + 1] = sim::LQI_CRC_OK;
+
+      for (auto *node : this->nodes_) {
+        if (node == f.from)
+          continue;
+        if (this->config_.loss_per_mille && (this->next_random_() % 1000) < this->config_.loss_per_mille) {
+          this->stats_.frames_lost++;
+          continue;
+        }
+        this->stats_.frames_delivered++;
+        node->on_frame(rx, n + CC1101_APPEND_SIZE);
+      }
+    }
+    this->in_flight_.pop_front();
+  }
+
+  for (auto *node : this->nodes_)
+    node->on_tick(now);
+}
+
+// ─── SimRadioDriver ────────────────────────────────────────────────────────
+
+bool SimRadioDriver::init() {
+  this->reset();
+  return true;
+}
+
+void SimRadioDriver::reset() {
+  this->rx_fifo_.clear();
+  this->tx_in_progress_ = false;
+  this->mode_ = RadioMode::RX;
+}
+
+bool SimRadioDriver::load_and_transmit(const uint8_t *pkt_buf, size_t len) {
+  if (this->tx_in_progress_ || len == 0 || len > FIFO_LENGTH)
+    return false;
+  this->mode_ = RadioMode::TX;
+  this->tx_in_progress_ = true;
+  this->tx_end_ms_ = this->medium_.transmit(this, pkt_buf, len);
+  this->stat_tx_++;
+  return true;
+}
+
+TxPollResult SimRadioDriver::poll_tx() {
+  if (!this->tx_in_progress_)
+    return TxPollResult::FAILED;
+  uint32_t now = get_time_provider().millis();
+  if (static_cast<int32_t>(now - this->tx_end_ms_) < 0)
+    return TxPollResult::PENDING;
+  this->tx_in_progress_ = false;
+  this->mode_ = RadioMode::RX;
+  if (this->tx_done_)
+    this->tx_done_->store(true, std::memory_order_release);
+  return TxPollResult::SUCCESS;
+}
+
+void SimRadioDriver::abort_tx() {
+  this->tx_in_progress_ = false;
+  this->mode_ = RadioMode::RX;
+}
+
+uint32_t SimRadioDriver::bitrate_bps() const {
+  uint32_t bps = this->medium_.config().bitrate_bps;
+  return bps ? bps : sim::BITRATE_BPS;
+}
+
+bool SimRadioDriver::sample_rssi(int16_t &dbm) {
+  if (this->mode_ != RadioMode::RX)
+    return false;
+  dbm = static_cast<int16_t>(this->medium_.rssi_dbm(get_time_provider().millis(), this));
+  return true;
+}
+
+bool SimRadioDriver::has_data() {
+  return this->mode_ == RadioMode::RX && !this->rx_fifo_.empty();
+}
+
+size_t SimRadioDriver::read_fifo(uint8_t *buf, size_t max_len) {
+  if (this->rx_fifo_.empty())
+    return 0;
+  auto &frame = this->rx_fifo_.front();
+  size_t n = frame.size() < max_len ? frame.size() : max_len;
+  std::copy(frame.begin(), frame.begin() + n, buf);
+  this->rx_fifo_.pop_front();
+  if (this->rx_fifo_.empty() && this->rx_ready_)
+    this->rx_ready_->store(false, std::memory_order_release);
+  return n;
+}
+
+RadioHealth SimRadioDriver::check_health() { return RadioHealth::OK; }
+
+void SimRadioDriver::recover() { this->reset(); }
+
+void SimRadioDriver::set_frequency_regs(uint8_t, uint8_t, uint8_t) { this->reset(); }
+
+void SimRadioDriver::on_frame(const uint8_t *frame, size_t len) {
+  // Half-duplex: deaf while transmitting
+  if (this->mode_ == RadioMode::TX)
+    return;
+  if (this->rx_fifo_.size() >= sim::RX_FIFO_FRAMES) {
+    this->stat_fifo_overflows_++;
+    return;
+  }
+  this->rx_fifo_.emplace_back(frame, frame + len);
+  this->stat_rx_++;
+  if (this->rx_ready_)
+    this->rx_ready_->store(true, std::memory_order_release);
+}
+
+// ─── SimBlind ──────────────────────────────────────────────────────────────
+
+SimBlind::SimBlind(SimMedium &medium, const SimBlindConfig &config)
+    : medium_(medium), config_(config), position_(config.start_position) {
+  this->rssi_dbm = config.rssi_dbm;
+  medium.attach(this);
+}
+
+uint8_t SimBlind::state_byte() const {
+  if (this->direction_ > 0)
+    return state::MOVING_UP;
+  if (this->direction_ < 0)
+    return state::MOVING_DOWN;
+  if (this->last_state_ == state::STOPPED)
+    return state::STOPPED;
+  if (this->position_ >= 1.0f)
+    return state::TOP;
+  if (this->position_ <= 0.0f)
+    return state::BOTTOM;
+  return state::INTERMEDIATE;
+}
+
+bool SimBlind::addressed_(const ParseResult &r, const uint8_t *frame) const {
+  if (this->config_.remote_address != 0 && r.src_addr != this->config_.remote_address)
+    return false;
+  if (is_command_packet(r.type))
+    return r.dst_addr == this->config_.address;
+  if (is_button_packet(r.type)) {
+    // Single (num_dests=1) and group 0x44 list destination channels from byte 17
+    for (uint8_t i = 0; i < r.num_dests; ++i) {
+      if (frame[pkt_offset::FIRST_DEST + i] == this->config_.channel)
+        return true;
+    }
+  }
+  return false;
+}
+
+void SimBlind::on_frame(const uint8_t *frame, size_t len) {
+  ParseResult r = parse_packet(frame, len);
+  if (!r.valid || !this->addressed_(r, frame))
+    return;
+
+  // Remotes repeat each press with the same counter — act once
+  if (this->seen_counter_ && r.counter == this->last_counter_ && r.src_addr == this->last_src_)
+    return;
+  this->seen_counter_ = true;
+  this->last_counter_ = r.counter;
+  this->last_src_ = r.src_addr;
+  this->stat_commands_++;
+
+  uint32_t now = get_time_provider().millis();
+  this->apply_command_(r.payload[payload_offset::COMMAND], now);
+
+  if (this->config_.remote_address == 0)
+    this->config_.remote_address = r.src_addr;
+  this->reply_pending_ = true;
+  this->reply_at_ms_ = now + this->config_.response_delay_ms;
+}
+
+void SimBlind::apply_command_(uint8_t cmd, uint32_t now) {
+  this->advance_(now);
+  switch (cmd) {
+    case command::UP:
+      this->direction_ = this->position_ < 1.0f ? 1 : 0;
+      this->last_state_ = state::UNKNOWN;
+      break;
+    case command::DOWN:
+      this->direction_ = this->position_ > 0.0f ? -1 : 0;
+      this->last_state_ = state::UNKNOWN;
+      break;
+    case command::STOP:
+      if (this->direction_ != 0)
+        this->last_state_ = state::STOPPED;
+      this->direction_ = 0;
+      break;
+    case command::CHECK:
+    default:
+      break;
+  }
+}
+
+void SimBlind::advance_(uint32_t now) {
+  uint32_t elapsed = now - this->last_advance_ms_;
+  this->last_advance_ms_ = now;
+  if (this->direction_ == 0 || this->config_.travel_ms == 0)
+    return;
+  this->position_ += this->direction_ * static_cast<float>(elapsed) / static_cast<float>(this->config_.travel_ms);
+  if (this->direction_ > 0 && this->position_ >= 1.0f) {
+    this->position_ = 1.0f;
+    this->direction_ = 0;
+  } else if (this->direction_ < 0 && this->position_ <= 0.0f) {
+    this->position_ = 0.0f;
+    this->direction_ = 0;
+  }
+}
+
+void SimBlind::on_tick(uint32_t now) {
+  this->advance_(now);
+  if (this->reply_pending_ && static_cast<int32_t>(now - this->reply_at_ms_) >= 0) {
+    this->reply_pending_ = false;
+    this->send_status_(this->state_byte());
+  }
+}
+
+void SimBlind::send_status_(uint8_t state_byte) {
+  TxParams params;
+  params.counter = this->tx_counter_;
+  params.dst_addr = this->config_.remote_address;
+  params.src_addr = this->config_.address;
+  params.channel = this->config_.channel;
+  params.type = msg_type::STATUS;
+  params.command = 0;
+  params.state = state_byte;
+
+  uint8_t buf[TX_MSG_LENGTH + 1];
+  size_t len = build_tx_packet(params, buf);
+  this->medium_.transmit(this, buf, len);
+
+  this->tx_counter_ = this->tx_counter_ >= limits::COUNTER_MAX ? 1 : this->tx_counter_ + 1;
+  this->stat_replies_++;
+}
+
+}  // namespace elero
+}  // namespace esphome
+
+#endif  // USE_ESP32
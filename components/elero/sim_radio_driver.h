@@ -0,0 +1,226 @@
+#pragma once
+
+/// @file sim_radio_driver.h
+/// @brief Host-side virtual radio: simulated RF medium, RadioDriver and Elero blind fleet.
+///
+/// Runs entirely on Linux — no SPI, no FreeRTOS, no ESPHome logging. Used by unit
+/// tests to load-test DeviceRegistry and CommandSender against realistic airtime
+/// contention, poll storms and queue overflows before firmware reaches the house.
+///
+/// All timing comes from get_time_provider(), so tests drive the simulation
+/// deterministically with MockTimeProvider::advance() + SimMedium::update().
+///
+/// Model:
+///   - SimMedium: one shared 868 MHz channel. Each frame occupies the air for
+///     airtime_ms(len). Overlapping frames collide and are lost at every receiver.
+///     Surviving frames are delivered latency_ms after the end of TX, with an
+///     independent per-receiver loss probability (seeded PRNG → reproducible).
+///   - SimRadioDriver: RadioDriver backed by a medium node. TX completes once the
+///     frame's airtime has elapsed. Received frames are queued in hub format
+///     [length | data | RSSI | LQI|CRC_OK], one frame per read_fifo().
+///   - SimBlind: answers CHECK/UP/DOWN/STOP (0x6A targeted, 0x44 button or group)
+///     from its paired remote with a 0xCA status packet, tracking travel time.
+
+#include "radio_driver.h"
+#include "elero_packet.h"
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <vector>
+
+namespace esphome {
+namespace elero {
+
+namespace sim {
+constexpr uint32_t BITRATE_BPS = 76800;     ///< CC1101 MDMCFG4/3 = 0x7B/0x83 → 76.8 kBaud
+constexpr uint8_t PREAMBLE_BYTES = 12;      ///< MDMCFG1 = 0x52 → 12 preamble bytes
+constexpr uint8_t SYNC_BYTES = 4;           ///< D3 91 D3 91 (SYNC_MODE=011 doubles it)
+constexpr uint8_t CRC_BYTES = 2;            ///< CC1101 CRC-16 appended on air
+constexpr uint8_t RX_FIFO_FRAMES = 2;       ///< 64-byte FIFO holds two Elero frames
+constexpr uint8_t LQI_CRC_OK = 0x80;        ///< Synthesized LQI byte (LQI=0, CRC_OK=1)
+constexpr float NOISE_FLOOR_DBM = -110.0f;  ///< RSSI of a quiet channel
+}  // namespace sim
+
+/// Convert a dBm value to the CC1101 raw RSSI byte (inverse of packet::calc_rssi).
+uint8_t sim_rssi_raw(float rssi_dbm);
+
+/// A participant on the simulated medium (radio driver or simulated blind).
+class SimNode {
+ public:
+  virtual ~SimNode() = default;
+
+  /// A frame was received. @p frame is in hub format (length byte first,
+  /// RSSI and LQI|CRC_OK appended), ready for packet::parse_packet().
+  virtual void on_frame(const uint8_t *frame, size_t len) = 0;
+
+  /// Called once per SimMedium::update(), after frame delivery.
+  virtual void on_tick([[maybe_unused]] uint32_t now) {}
+
+  /// Signal strength other nodes hear from this node.
+  float rssi_dbm{-60.0f};
+};
+
+/// Medium parameters. Defaults model an ideal channel (no latency, no loss).
+struct SimMediumConfig {
+  uint32_t bitrate_bps{sim::BITRATE_BPS};
+  uint32_t latency_ms{0};          ///< Extra delay between end of TX and delivery
+  uint16_t loss_per_mille{0};      ///< Independent per-receiver frame loss (0..1000)
+  bool collisions{true};           ///< Overlapping frames destroy each other
+  uint32_t seed{1};                ///< PRNG seed (same seed → identical run)
+};
+
+/// Medium-wide counters.
+struct SimMediumStats {
+  uint32_t frames_sent{0};
+  uint32_t frames_delivered{0};   ///< Per receiver
+  uint32_t frames_lost{0};        ///< Per receiver, random loss
+  uint32_t frames_collided{0};    ///< Per frame, destroyed by overlap
+  uint32_t airtime_ms{0};         ///< Total time on air
+};
+
+/// Shared RF channel connecting all simulated nodes.
+class SimMedium {
+ public:
+  explicit SimMedium(const SimMediumConfig &config = {});
+
+  void attach(SimNode *node) { this->nodes_.push_back(node); }
+
+  /// Put a frame on the air. @p pkt is [length | data...] (unwhitened, no CRC).
+  /// @return Time at which the frame leaves the air (TX complete)
+  uint32_t transmit(const SimNode *from, const uint8_t *pkt, size_t len);
+
+  /// Deliver all frames whose delivery time has passed, then tick every node.
+  void update();
+
+  /// True while any frame is on the air at @p now.
+  [[nodiscard]] bool busy(uint32_t now) const;
+
+  /// Strongest signal on the air at @p now as heard by @p listener (its own
+  /// frames excluded); sim::NOISE_FLOOR_DBM while the channel is quiet.
+  [[nodiscard]] float rssi_dbm(uint32_t now, const SimNode *listener) const;
+
+  /// On-air duration of a frame with @p len bytes (length byte + data).
+  [[nodiscard]] uint32_t airtime_ms(size_t len) const;
+
+  [[nodiscard]] const SimMediumStats &stats() const { return this->stats_; }
+  [[nodiscard]] const SimMediumConfig &config() const { return this->config_; }
+
+ private:
+  struct Frame {
+    const SimNode *from;
+    std::vector<uint8_t> bytes;
+    uint32_t start_ms;
+    uint32_t end_ms;
+    bool collided;
+  };
+
+  uint32_t next_random_();
+
+  SimMediumConfig config_;
+  SimMediumStats stats_;
+  std::vector<SimNode *> nodes_;
+  std::deque<Frame> in_flight_;
+  uint32_t rng_state_;
+};
+
+/// RadioDriver implementation backed by a SimMedium node.
+class SimRadioDriver : public RadioDriver, public SimNode {
+ public:
+  explicit SimRadioDriver(SimMedium &medium) : medium_(medium) { medium.attach(this); }
+
+  // ── RadioDriver interface ──────────────────────────────────────────────────
+
+  bool init() override;
+  void reset() override;
+
+  bool load_and_transmit(const uint8_t *pkt_buf, size_t len) override;
+  TxPollResult poll_tx() override;
+  void abort_tx() override;
+
+  bool has_data() override;
+  size_t read_fifo(uint8_t *buf, size_t max_len) override;
+  bool sample_rssi(int16_t &dbm) override;
+
+  RadioHealth check_health() override;
+  void recover() override;
+
+  void set_frequency_regs(uint8_t f2, uint8_t f1, uint8_t f0) override;
+  void dump_config() override {}
+  const char *radio_name() const override { return "sim"; }
+  uint32_t bitrate_bps() const override;
+  int rx_sensitivity_dbm() const override { return -104; }
+
+  // ── SimNode interface ──────────────────────────────────────────────────────
+
+  void on_frame(const uint8_t *frame, size_t len) override;
+
+  // ── Diagnostics ────────────────────────────────────────────────────────────
+
+  uint32_t overflow_count() const { return this->stat_fifo_overflows_; }
+  uint32_t tx_count() const { return this->stat_tx_; }
+  uint32_t rx_count() const { return this->stat_rx_; }
+
+ private:
+  SimMedium &medium_;
+  std::deque<std::vector<uint8_t>> rx_fifo_;
+  bool tx_in_progress_{false};
+  uint32_t tx_end_ms_{0};
+  uint32_t stat_fifo_overflows_{0};
+  uint32_t stat_tx_{0};
+  uint32_t stat_rx_{0};
+};
+
+/// Physical parameters of a simulated blind.
+struct SimBlindConfig {
+  uint32_t address{0};             ///< Blind address (dst of 0x6A, src of 0xCA)
+  uint32_t remote_address{0};      ///< Paired remote (0 = obey any source)
+  uint8_t channel{0};              ///< Channel for 0x44 button/group packets
+  uint32_t travel_ms{20000};       ///< Full travel time (closed ↔ open)
+  uint32_t response_delay_ms{30};  ///< Command → status reply delay
+  float rssi_dbm{-60.0f};
+  float start_position{0.0f};      ///< 0.0 = closed, 1.0 = open
+};
+
+/// Simulated Elero blind motor. Obeys commands from its paired remote and
+/// replies with a 0xCA status packet. Repeats of the same rolling counter
+/// are treated as one press, like the real receiver.
+class SimBlind : public SimNode {
+ public:
+  SimBlind(SimMedium &medium, const SimBlindConfig &config);
+
+  void on_frame(const uint8_t *frame, size_t len) override;
+  void on_tick(uint32_t now) override;
+
+  /// Current Elero state byte (TOP/BOTTOM/INTERMEDIATE/MOVING_*/STOPPED).
+  [[nodiscard]] uint8_t state_byte() const;
+
+  [[nodiscard]] float position() const { return this->position_; }
+  [[nodiscard]] bool moving() const { return this->direction_ != 0; }
+  [[nodiscard]] const SimBlindConfig &config() const { return this->config_; }
+  [[nodiscard]] uint32_t commands_received() const { return this->stat_commands_; }
+  [[nodiscard]] uint32_t replies_sent() const { return this->stat_replies_; }
+
+ private:
+  [[nodiscard]] bool addressed_(const packet::ParseResult &r, const uint8_t *frame) const;
+  void apply_command_(uint8_t cmd, uint32_t now);
+  void advance_(uint32_t now);
+  void send_status_(uint8_t state_byte);
+
+  SimMedium &medium_;
+  SimBlindConfig config_;
+  float position_;
+  int8_t direction_{0};            ///< +1 opening, -1 closing, 0 idle
+  uint32_t last_advance_ms_{0};
+  uint8_t last_state_{packet::state::UNKNOWN};  ///< Sticky STOPPED after a STOP
+  bool reply_pending_{false};
+  uint32_t reply_at_ms_{0};
+  bool seen_counter_{false};
+  uint8_t last_counter_{0};
+  uint32_t last_src_{0};
+  uint8_t tx_counter_{1};
+  uint32_t stat_commands_{0};
+  uint32_t stat_replies_{0};
+};
+
+}  // namespace elero
+}  // namespace esphome
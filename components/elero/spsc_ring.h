@@ -0,0 +1,85 @@
+#pragma once
+
+/// @file spsc_ring.h
+/// @brief Lock-free single-producer/single-consumer ring with in-place slots.
+///
+/// Replaces a FreeRTOS queue for large items on the RF task → main loop path:
+/// the producer fills a slot directly (acquire + commit) and the consumer reads
+/// it where it lies (front + pop), so no item is ever copied by the transport.
+///
+/// Exactly one thread may call acquire()/commit() and exactly one other thread
+/// may call front()/pop(). Head and tail live on separate cache lines so the
+/// two cores don't false-share on every packet. No heap, no kernel calls.
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+
+namespace esphome {
+namespace elero {
+
+/// Cache line size used to separate producer and consumer indices.
+/// ESP32 cache lines are 32 bytes; 64 also covers host CPUs running tests.
+constexpr size_t SPSC_CACHE_LINE = 64;
+
+template<typename T, size_t N> class SpscRing {
+  static_assert(N >= 2 && (N & (N - 1)) == 0, "SpscRing size must be a power of two");
+
+ public:
+  // ── Producer side ─────────────────────────────────────────────────────────
+
+  /// Slot to fill in place, or nullptr if the ring is full. Calling acquire()
+  /// again without commit() returns the same slot.
+  T *acquire() {
+    uint32_t head = this->head_.load(std::memory_order_relaxed);
+    uint32_t tail = this->tail_.load(std::memory_order_acquire);
+    if (head - tail >= N)
+      return nullptr;
+    return &this->slots_[head & MASK];
+  }
+
+  /// Publish the slot returned by acquire() to the consumer.
+  void commit() {
+    uint32_t head = this->head_.load(std::memory_order_relaxed) + 1;
+    this->head_.store(head, std::memory_order_release);
+    uint32_t depth = head - this->tail_.load(std::memory_order_relaxed);
+    if (depth > this->high_water_.load(std::memory_order_relaxed))
+      this->high_water_.store(depth, std::memory_order_relaxed);
+  }
+
+  // ── Consumer side ─────────────────────────────────────────────────────────
+
+  /// Oldest published slot, or nullptr if empty. Valid until pop().
+  T *front() {
+    uint32_t tail = this->tail_.load(std::memory_order_relaxed);
+    if (tail == this->head_.load(std::memory_order_acquire))
+      return nullptr;
+    return &this->slots_[tail & MASK];
+  }
+
+  /// Release the slot returned by front() back to the producer.
+  void pop() { this->tail_.store(this->tail_.load(std::memory_order_relaxed) + 1, std::memory_order_release); }
+
+  // ── Diagnostics (any thread, approximate) ─────────────────────────────────
+
+  [[nodiscard]] size_t size() const {
+    return this->head_.load(std::memory_order_acquire) - this->tail_.load(std::memory_order_acquire);
+  }
+  [[nodiscard]] bool empty() const { return this->size() == 0; }
+  [[nodiscard]] static constexpr size_t capacity() { return N; }
+
+  /// Highest fill level seen since construction (or reset_high_water()).
+  [[nodiscard]] uint32_t high_water() const { return this->high_water_.load(std::memory_order_relaxed); }
+  void reset_high_water() { this->high_water_.store(0, std::memory_order_relaxed); }
+
+ private:
+  static constexpr uint32_t MASK = N - 1;
+
+  alignas(SPSC_CACHE_LINE) std::atomic<uint32_t> head_{0};  ///< Written by producer
+  std::atomic<uint32_t> high_water_{0};                      ///< Written by producer
+  alignas(SPSC_CACHE_LINE) std::atomic<uint32_t> tail_{0};  ///< Written by consumer
+  alignas(SPSC_CACHE_LINE) T slots_[N]{};
+};
+
+}  // namespace elero
+}  // namespace esphome
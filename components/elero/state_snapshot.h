@@ -2,6 +2,8 @@
 /// @brief State projection layer — single source of truth for what HA sees.
 ///
 /// Snapshots are ephemeral: computed on demand from (Device, now), never persisted.
+/// Adapters read them through DeviceRegistry::cover_snapshot()/light_snapshot(),
+/// which memoize one per device and tick.
 /// All output adapters (native, MQTT, WebSocket, Matter) consume these structs
 /// instead of independently deriving state. This eliminates inconsistencies.
 
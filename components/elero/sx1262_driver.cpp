@@ -582,6 +582,15 @@ bool Sx1262Driver::has_data() {
   return this->rx_ready_ != nullptr && this->rx_ready_->load(std::memory_order_acquire);
 }
 
+bool Sx1262Driver::sample_rssi(int16_t &dbm) {
+  if (this->RadioDriver::mode_ != RadioMode::RX) return false;
+  // GetRssiInst: RssiInst = -2 × dBm
+  uint8_t rssi_inst = 0;
+  if (!this->read_opcode_(sx1262::GET_RSSI_INST, &rssi_inst, 1)) return false;
+  dbm = static_cast<int16_t>(-static_cast<int>(rssi_inst) / 2);
+  return true;
+}
+
 size_t Sx1262Driver::read_fifo(uint8_t *buf, size_t max_len) {
   // Read and clear IRQ status
   uint8_t irq_buf[2] = {};
@@ -624,20 +633,31 @@ size_t Sx1262Driver::read_fifo(uint8_t *buf, size_t max_len) {
   uint8_t *data = raw;
   size_t data_len = payload_len;
 
-  // Apply CC1101 IBM PN9 de-whitening in software.
-  this->apply_pn9_(data, data_len);
+  // Apply CC1101 IBM PN9 de-whitening in software, length byte first so
+  // noise frames are rejected before the rest of the buffer is touched.
+  uint8_t raw0 = data[0];
+  this->apply_pn9_(data, 1);
 
   // First de-whitened byte = Elero packet length.
   uint8_t pkt_len = data[0];
 
   if (pkt_len < 0x1B || pkt_len > 0x1E) {
-    ESP_LOGD(TAG, "bad length 0x%02x after de-whiten (raw[0]=0x%02x)", data[0], raw[0]);
+    ESP_LOGD(TAG, "bad length 0x%02x after de-whiten (raw[0]=0x%02x)", data[0], raw0);
     return 0;
   }
+  this->apply_pn9_(data + 1, data_len - 1, 1);
 
   // Hub format: [length | data... | RSSI | LQI|CRC_OK]
   size_t total = 1 + pkt_len + 2;
-  if (total > max_len || (1 + pkt_len) > data_len) {
+  if (total > max_len || total > data_len) {
+    return 0;
+  }
+
+  // Verify the CC1101 CRC-16 that follows the data; drop corrupted frames here
+  // instead of passing them through decode, the RX queue and dispatch.
+  if (!cc1101_crc_ok(data, total)) {
+    this->stat_crc_errors_.fetch_add(1, std::memory_order_relaxed);
+    ESP_LOGD(TAG, "CRC mismatch, dropping %d-byte frame", static_cast<int>(total));
     return 0;
   }
 
@@ -651,7 +671,7 @@ size_t Sx1262Driver::read_fifo(uint8_t *buf, size_t max_len) {
   int cc1101_rssi = rssi_dbm_x2 + 148;
   if (cc1101_rssi < 0) cc1101_rssi += 256;
   buf[1 + pkt_len] = static_cast<uint8_t>(cc1101_rssi);
-  buf[1 + pkt_len + 1] = 0x80;  // LQI=0, CRC_OK=1
+  buf[1 + pkt_len + 1] = 0x80;  // LQI=0, CRC_OK=1 (verified above)
 
   return total;
 }
@@ -1058,8 +1078,8 @@ void Sx1262Driver::apply_errata_sensitivity_() {
   this->write_register_(sx1262::REG_SENSITIVITY_CFG, &sens_cfg, 1);
 }
 
-void Sx1262Driver::apply_pn9_(uint8_t *data, size_t len) {
-  cc1101_pn9_whiten(data, len);
+void Sx1262Driver::apply_pn9_(uint8_t *data, size_t len, size_t offset) {
+  cc1101_pn9_whiten_from(data, len, offset);
 }
 
 void Sx1262Driver::restore_rx_packet_params_() {
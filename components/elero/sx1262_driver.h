@@ -128,11 +128,11 @@ constexpr uint32_t FREQ_868_95 = 0x3648A666U;
 // SX1262 buffer size (shared 256-byte buffer, but Elero packets are max ~30 bytes)
 constexpr uint8_t MAX_PACKET_SIZE = 64;  // Match CC1101_FIFO_LENGTH for compatibility
 
-// Fixed RX length: Elero packets are 28-31 bytes (length byte + 27-30 data).
-// With 32-bit sync (D3 91 D3 91), the SX1262 strips the full sync word.
-// Buffer starts with the whitened payload. Use 32 to cover all packet sizes
-// (max: length 0x1E = 30 data + 1 length byte = 31, plus margin).
-constexpr uint8_t RX_FIXED_LEN = 32;
+// Fixed RX length: Elero frames are 30-33 bytes on air (length byte + 27-30
+// data + 2 CRC). With 32-bit sync (D3 91 D3 91), the SX1262 strips the full
+// sync word. Buffer starts with the whitened payload. Use 33 so the CRC of the
+// longest frame (length 0x1E) is captured and can be verified in software.
+constexpr uint8_t RX_FIXED_LEN = 33;
 
 // BUSY pin timeout
 constexpr uint32_t BUSY_TIMEOUT_MS = 20;
@@ -161,6 +161,7 @@ class Sx1262Driver : public RadioDriver,
 
   bool has_data() override;
   size_t read_fifo(uint8_t *buf, size_t max_len) override;
+  bool sample_rssi(int16_t &dbm) override;
 
   RadioHealth check_health() override;
   void recover() override;
@@ -168,6 +169,7 @@ class Sx1262Driver : public RadioDriver,
   void set_frequency_regs(uint8_t f2, uint8_t f1, uint8_t f0) override;
   void dump_config() override;
   const char *radio_name() const override { return "sx1262"; }
+  uint32_t bitrate_bps() const override { return 76766; }  // sx1262::ELERO_BITRATE
   int rx_sensitivity_dbm() const override { return -117; }
   bool irq_rising_edge() const override { return true; }
 
@@ -196,6 +198,7 @@ class Sx1262Driver : public RadioDriver,
   uint32_t overflow_count() const { return 0; }  // SX1262 has no FIFO overflow
   uint32_t watchdog_count() const { return stat_watchdog_recoveries_.load(std::memory_order_relaxed); }
   uint32_t recover_count() const { return stat_tx_recover_.load(std::memory_order_relaxed); }
+  uint32_t crc_error_count() const { return stat_crc_errors_.load(std::memory_order_relaxed); }
 
  private:
   // ── SPI primitives ─────────────────────────────────────────────────────────
@@ -225,7 +228,7 @@ class Sx1262Driver : public RadioDriver,
   void restore_rx_packet_params_();
   void apply_errata_pa_clamping_();
   void apply_errata_sensitivity_();
-  void apply_pn9_(uint8_t *data, size_t len);
+  void apply_pn9_(uint8_t *data, size_t len, size_t offset = 0);
   uint32_t freq_reg_from_cc1101_regs_() const;
 
   // ── TX state ───────────────────────────────────────────────────────────────
@@ -273,6 +276,7 @@ class Sx1262Driver : public RadioDriver,
 
   std::atomic<uint32_t> stat_watchdog_recoveries_{0};
   std::atomic<uint32_t> stat_tx_recover_{0};
+  std::atomic<uint32_t> stat_crc_errors_{0};
 };
 
 }  // namespace elero
@@ -208,6 +208,13 @@ bool Sx1276Driver::has_data() {
   return this->rx_ready_ != nullptr && this->rx_ready_->load(std::memory_order_acquire);
 }
 
+bool Sx1276Driver::sample_rssi(int16_t &dbm) {
+  if (this->RadioDriver::mode_ != RadioMode::RX) return false;
+  // FSK RssiValue: -RssiValue / 2 dBm, smoothed over 16 samples (REG_RSSI_CONFIG)
+  dbm = static_cast<int16_t>(-static_cast<int>(this->read_reg_(sx1276::REG_RSSI_VALUE)) / 2);
+  return true;
+}
+
 size_t Sx1276Driver::read_fifo(uint8_t *buf, size_t max_len) {
   // Check PayloadReady flag
   uint8_t irq2 = this->read_reg_(sx1276::REG_IRQ_FLAGS2);
@@ -236,7 +243,8 @@ size_t Sx1276Driver::read_fifo(uint8_t *buf, size_t max_len) {
 
   // Apply CC1101 IBM PN9 de-whitening in software.
   // The SX1276 hardware whitening is incompatible with CC1101 PN9.
-  cc1101_pn9_whiten(raw, sx1276::RX_FIXED_LEN);
+  // Length byte first so noise frames are rejected before the rest is touched.
+  cc1101_pn9_whiten(raw, 1);
 
   // First de-whitened byte = Elero packet length.
   uint8_t pkt_len = raw[0];
@@ -245,10 +253,19 @@ size_t Sx1276Driver::read_fifo(uint8_t *buf, size_t max_len) {
     ESP_LOGD(TAG, "bad length 0x%02x after de-whiten", raw[0]);
     return 0;
   }
+  cc1101_pn9_whiten_from(raw + 1, sx1276::RX_FIXED_LEN - 1, 1);
 
   // Hub format: [length | data... | RSSI | LQI|CRC_OK]
   size_t total = 1 + pkt_len + 2;
-  if (total > max_len || (1 + pkt_len) > sx1276::RX_FIXED_LEN) {
+  if (total > max_len || total > sx1276::RX_FIXED_LEN) {
+    return 0;
+  }
+
+  // Verify the CC1101 CRC-16 that follows the data; drop corrupted frames here
+  // instead of passing them through decode, the RX queue and dispatch.
+  if (!cc1101_crc_ok(raw, total)) {
+    this->stat_crc_errors_.fetch_add(1, std::memory_order_relaxed);
+    ESP_LOGD(TAG, "CRC mismatch, dropping %d-byte frame", static_cast<int>(total));
     return 0;
   }
 
@@ -265,7 +282,7 @@ size_t Sx1276Driver::read_fifo(uint8_t *buf, size_t max_len) {
   int cc1101_rssi = -static_cast<int>(rssi_raw) + 148;
   if (cc1101_rssi < 0) cc1101_rssi += 256;
   buf[1 + pkt_len] = static_cast<uint8_t>(cc1101_rssi);
-  buf[1 + pkt_len + 1] = 0x80;  // LQI=0, CRC_OK=1
+  buf[1 + pkt_len + 1] = 0x80;  // LQI=0, CRC_OK=1 (verified above)
 
   return total;
 }
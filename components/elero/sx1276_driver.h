@@ -186,9 +186,9 @@ constexpr uint8_t ELERO_AFC_BW = 0x0A;  // Mant=16(00), Exp=2 → 32M/(16*16) =
 // FIFO size
 constexpr uint8_t FIFO_SIZE = 64;
 
-// Fixed RX length: same as SX1262, covers all Elero packet sizes.
-// Elero packets are 28-31 bytes (length byte + 27-30 data + 2 CRC).
-constexpr uint8_t RX_FIXED_LEN = 32;
+// Fixed RX length: same as SX1262, covers all Elero frame sizes including CRC.
+// Elero frames are 30-33 bytes (length byte + 27-30 data + 2 CRC).
+constexpr uint8_t RX_FIXED_LEN = 33;
 
 // Chip version
 constexpr uint8_t EXPECTED_VERSION = 0x12;
@@ -218,6 +218,7 @@ class Sx1276Driver : public RadioDriver,
 
   bool has_data() override;
   size_t read_fifo(uint8_t *buf, size_t max_len) override;
+  bool sample_rssi(int16_t &dbm) override;
 
   RadioHealth check_health() override;
   void recover() override;
@@ -225,6 +226,7 @@ class Sx1276Driver : public RadioDriver,
   void set_frequency_regs(uint8_t f2, uint8_t f1, uint8_t f0) override;
   void dump_config() override;
   const char *radio_name() const override { return "sx1276"; }
+  uint32_t bitrate_bps() const override { return 76800; }  // sx1276::ELERO_BITRATE_*
   int rx_sensitivity_dbm() const override { return -117; }
   bool irq_rising_edge() const override { return true; }  // DIO0 goes HIGH on PayloadReady/PacketSent
 
@@ -247,6 +249,7 @@ class Sx1276Driver : public RadioDriver,
   uint32_t overflow_count() const { return stat_fifo_overflows_.load(std::memory_order_relaxed); }
   uint32_t watchdog_count() const { return stat_watchdog_recoveries_.load(std::memory_order_relaxed); }
   uint32_t recover_count() const { return stat_tx_recover_.load(std::memory_order_relaxed); }
+  uint32_t crc_error_count() const { return stat_crc_errors_.load(std::memory_order_relaxed); }
 
  private:
   // ── SPI primitives ─────────────────────────────────────────────────────────
@@ -308,6 +311,7 @@ class Sx1276Driver : public RadioDriver,
   std::atomic<uint32_t> stat_fifo_overflows_{0};
   std::atomic<uint32_t> stat_watchdog_recoveries_{0};
   std::atomic<uint32_t> stat_tx_recover_{0};
+  std::atomic<uint32_t> stat_crc_errors_{0};
 };
 
 }  // namespace elero
@@ -0,0 +1,105 @@
+#pragma once
+
+/// @file tx_burst.h
+/// @brief Repeated-packet transmission scheduled inside the RF task — pure logic, no FreeRTOS deps.
+///
+/// A button press is sent as several identical packets (same counter, as
+/// physical remotes do) spaced by INTER_PACKET_MS. Driving each repeat from
+/// the main loop costs a tx_queue → RF task → tx_done_queue round-trip per
+/// packet and lets ESPHome loop jitter stretch the gaps. A TX_BURST request
+/// hands the whole phase to the RF task: the packet is built once, repeated on
+/// the RF task's own clock, and the result of every repeat is reported once.
+
+#include <cstdint>
+
+namespace esphome {
+namespace elero {
+
+/// Maximum packets in one burst (one bit per packet in TxBurstReport::ok_mask).
+constexpr uint8_t TX_BURST_MAX_PACKETS = 8;
+
+/// Outcome of a burst, delivered once via TxClient::on_tx_burst_complete().
+struct TxBurstReport {
+  uint8_t packets{0};  ///< Packets attempted
+  uint8_t ok_mask{0};  ///< Bit i set = packet i transmitted successfully
+
+  [[nodiscard]] uint8_t sent_ok() const {
+    uint8_t n = 0;
+    for (uint8_t m = this->ok_mask; m != 0; m &= m - 1)
+      ++n;
+    return n;
+  }
+  [[nodiscard]] bool all_ok() const { return this->packets > 0 && this->sent_ok() == this->packets; }
+};
+
+/// Burst progress, owned by the RF task. The gap is measured from the end of
+/// one packet to the start of the next, matching CommandSender's WAIT_DELAY.
+struct TxBurst {
+  /// Begin a burst of @p packets (clamped to 1..TX_BURST_MAX_PACKETS); the
+  /// first packet is due immediately.
+  void start(uint8_t packets, uint8_t gap_ms, uint32_t now) {
+    if (packets == 0)
+      packets = 1;
+    this->report_ = {packets > TX_BURST_MAX_PACKETS ? TX_BURST_MAX_PACKETS : packets, 0};
+    this->gap_ms_ = gap_ms;
+    this->sent_ = 0;
+    this->next_ms_ = now;
+  }
+
+  /// A burst is active from start() until every packet has a result.
+  [[nodiscard]] bool active() const { return this->sent_ < this->report_.packets; }
+
+  /// Every packet has a result and the report has not been taken yet.
+  [[nodiscard]] bool finished() const { return this->report_.packets > 0 && !this->active(); }
+
+  /// Forget the burst once its report has been posted.
+  void clear() { *this = TxBurst{}; }
+
+  /// The next packet may be loaded into the radio.
+  [[nodiscard]] bool due(uint32_t now) const {
+    return this->active() && static_cast<int32_t>(now - this->next_ms_) >= 0;
+  }
+
+  /// millis() at which the next packet is due (meaningful while active()).
+  [[nodiscard]] uint32_t next_ms() const { return this->next_ms_; }
+
+  /// Push the next packet back to @p until (listen-before-talk found the
+  /// channel busy).
+  void defer(uint32_t until) {
+    if (this->active())
+      this->next_ms_ = until;
+  }
+
+  /// Record the result of the current packet, finished at @p now.
+  void on_packet_done(bool success, uint32_t now) {
+    if (!this->active())
+      return;
+    if (success)
+      this->report_.ok_mask |= static_cast<uint8_t>(1u << this->sent_);
+    ++this->sent_;
+    this->next_ms_ = now + this->gap_ms_;
+  }
+
+  /// The receiver already acknowledged: drop the packets not sent yet, so the
+  /// report covers only those that went out. Call between packets; before the
+  /// first one it does nothing and returns false — keep the abort for later.
+  bool abort() {
+    if (!this->active())
+      return true;
+    if (this->sent_ == 0)
+      return false;
+    this->report_.packets = this->sent_;
+    return true;
+  }
+
+  [[nodiscard]] const TxBurstReport &report() const { return this->report_; }
+
+ private:
+  TxBurstReport report_{};
+  uint8_t gap_ms_{0};
+  uint8_t sent_{0};
+  uint32_t next_ms_{0};
+};
+
+}  // namespace elero
+}  // namespace esphome
@@ -1,6 +1,7 @@
 #pragma once
 
 #include <cstdint>
+#include "tx_burst.h"
 
 namespace esphome::elero {
 
@@ -39,6 +40,11 @@ class TxClient {
   ///                false on timeout, hardware error, or abort
   virtual void on_tx_complete(bool success) = 0;
 
+  /// Called by Elero hub when a request_tx_burst() finishes, once per burst,
+  /// with the result of every packet. Same guarantees as on_tx_complete().
+  /// Default: treat the burst as one TX that succeeded only if every packet did.
+  virtual void on_tx_burst_complete(const TxBurstReport &report) { this->on_tx_complete(report.all_ok()); }
+
  protected:
   // Only derived classes can construct
   TxClient() = default;
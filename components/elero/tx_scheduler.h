@@ -0,0 +1,193 @@
+/// @file tx_scheduler.h
+/// @brief Hub-wide TX arbitration — priority classes, per-device fairness, queueing delay.
+///
+/// CommandSenders no longer post straight into the RF task's FIFO queue. Each
+/// sender hands its next request (one at a time — it waits in TX_PENDING for
+/// the completion) to this scheduler, which keeps only MAX_IN_FLIGHT requests
+/// in the RF queue: one on air, one staged so the radio never idles between
+/// loops. Everything else waits here, where it can still be overtaken:
+/// a STOP goes before user moves, moves before follow-up CHECKs, and those
+/// before background polls. Within a class the oldest request wins, and since
+/// a device has at most one request waiting, a busy device cannot starve the
+/// others — its next request always queues behind theirs.
+///
+/// Queued-but-unsent work can be withdrawn (the device got a new command) and
+/// never reaches the radio.
+///
+/// Pure logic, no ESPHome deps. Fixed-size, no heap.
+
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include "elero_packet.h"
+#include "tx_client.h"
+
+namespace esphome::elero {
+
+namespace tx_sched {
+constexpr size_t MAX_IN_FLIGHT = 2;        ///< Requests handed to the RF task at once
+constexpr uint32_t DELAY_WINDOW_MS = 60000; ///< Queueing delay metric window
+}  // namespace tx_sched
+
+enum class TxClass : uint8_t {
+    SAFETY = 0,      ///< STOP — the latency users notice
+    USER = 1,        ///< Moves, tilt, light commands
+    FOLLOW_UP = 2,   ///< CHECK after a command or while moving
+    BACKGROUND = 3,  ///< Routine idle poll
+};
+constexpr size_t TX_CLASS_COUNT = 4;
+
+/// Class of a command byte. CHECKs are FOLLOW_UP unless the caller knows it
+/// is a routine poll.
+constexpr TxClass tx_class_of(uint8_t cmd, bool routine_poll) {
+    if (cmd == packet::command::STOP) return TxClass::SAFETY;
+    if (cmd == packet::command::CHECK) return routine_poll ? TxClass::BACKGROUND : TxClass::FOLLOW_UP;
+    return TxClass::USER;
+}
+
+/// One sender's request, as it will be posted to the RF task.
+struct TxRequest {
+    TxClient *client{nullptr};
+    EleroCommand cmd{};
+    uint8_t packets{1};
+    uint8_t gap_ms{0};
+};
+
+template<size_t N>
+class TxScheduler {
+ public:
+    /// Queue (or replace) the request of @p id. A replaced request keeps its age.
+    void submit(uint8_t id, TxClass cls, const TxRequest &req, uint32_t now) {
+        if (id >= N) return;
+        auto &s = slots_[id];
+        if (!s.queued) {
+            s.queued = true;
+            s.since = now;
+            ++queued_count_;
+        }
+        s.cls = cls;
+        s.req = req;
+    }
+
+    /// Drop @p id's request if it has not been handed to the radio yet.
+    /// Returns true if one was dropped.
+    bool withdraw(uint8_t id) {
+        if (id >= N || !slots_[id].queued) return false;
+        slots_[id].queued = false;
+        --queued_count_;
+        return true;
+    }
+
+    /// Forget everything about @p id (device removed).
+    void cancel(uint8_t id) {
+        (void) withdraw(id);
+        on_done(id);
+    }
+
+    [[nodiscard]] bool queued(uint8_t id) const { return id < N && slots_[id].queued; }
+    [[nodiscard]] bool in_flight(uint8_t id) const { return id < N && slots_[id].in_flight; }
+    [[nodiscard]] size_t queued_count() const { return queued_count_; }
+    [[nodiscard]] size_t in_flight_count() const { return in_flight_count_; }
+    [[nodiscard]] const TxRequest &request(uint8_t id) const { return slots_[id].req; }
+    /// Class of @p id's queued request (meaningful while queued()).
+    [[nodiscard]] TxClass queued_class(uint8_t id) const { return slots_[id].cls; }
+
+    /// Best queued request if the RF queue has room. The caller posts it and
+    /// calls on_posted() (or leaves it queued if the post failed). Requests of
+    /// classes below @p lowest stay queued (duty-cycle deferral).
+    [[nodiscard]] bool next(uint8_t &id, TxClass lowest = TxClass::BACKGROUND) const {
+        if (queued_count_ == 0 || in_flight_count_ >= tx_sched::MAX_IN_FLIGHT) return false;
+        size_t best = N;
+        for (size_t i = 0; i < N; ++i) {
+            const auto &s = slots_[i];
+            if (!s.queued || s.cls > lowest) continue;
+            if (best == N || s.cls < slots_[best].cls ||
+                (s.cls == slots_[best].cls && static_cast<int32_t>(s.since - slots_[best].since) < 0)) {
+                best = i;
+            }
+        }
+        if (best == N) return false;
+        id = static_cast<uint8_t>(best);
+        return true;
+    }
+
+    /// @p id's request was accepted by the RF task.
+    void on_posted(uint8_t id, uint32_t now) {
+        if (id >= N || !slots_[id].queued) return;
+        auto &s = slots_[id];
+        s.queued = false;
+        --queued_count_;
+        if (!s.in_flight) {
+            s.in_flight = true;
+            ++in_flight_count_;
+        }
+        roll_(now);
+        auto &m = metrics_[static_cast<size_t>(s.cls)];
+        uint32_t delay = now - s.since;
+        ++m.sent_total;
+        if (delay > m.max_delay_ms) m.max_delay_ms = delay;
+        m.window_delay_ms += delay;
+        ++m.window_sent;
+    }
+
+    /// @p id's posted request completed (or its sender gave up on it).
+    void on_done(uint8_t id) {
+        if (id >= N || !slots_[id].in_flight) return;
+        slots_[id].in_flight = false;
+        --in_flight_count_;
+    }
+
+    /// Close a finished metric window. Call once per loop.
+    void update(uint32_t now) { roll_(now); }
+
+    // ─── Metrics ───
+    [[nodiscard]] uint32_t sent_total(TxClass cls) const { return metrics_[static_cast<size_t>(cls)].sent_total; }
+    /// Largest submit→post delay seen for @p cls.
+    [[nodiscard]] uint32_t max_delay_ms(TxClass cls) const { return metrics_[static_cast<size_t>(cls)].max_delay_ms; }
+    /// Mean submit→post delay for @p cls over the last closed window.
+    [[nodiscard]] float avg_delay_ms(TxClass cls) const { return metrics_[static_cast<size_t>(cls)].avg_delay_ms; }
+
+ private:
+    struct Slot {
+        bool queued{false};
+        bool in_flight{false};
+        TxClass cls{TxClass::BACKGROUND};
+        uint32_t since{0};
+        TxRequest req{};
+    };
+    struct ClassMetrics {
+        uint32_t sent_total{0};
+        uint32_t max_delay_ms{0};
+        uint32_t window_sent{0};
+        uint32_t window_delay_ms{0};
+        float avg_delay_ms{0.0f};
+    };
+
+    void roll_(uint32_t now) {
+        if (!started_) {
+            started_ = true;
+            window_start_ms_ = now;
+            return;
+        }
+        if ((now - window_start_ms_) < tx_sched::DELAY_WINDOW_MS) return;
+        for (auto &m : metrics_) {
+            m.avg_delay_ms = m.window_sent > 0
+                ? static_cast<float>(m.window_delay_ms) / static_cast<float>(m.window_sent)
+                : 0.0f;
+            m.window_sent = 0;
+            m.window_delay_ms = 0;
+        }
+        window_start_ms_ = now;
+    }
+
+    std::array<Slot, N> slots_{};
+    size_t queued_count_{0};
+    size_t in_flight_count_{0};
+    std::array<ClassMetrics, TX_CLASS_COUNT> metrics_{};
+    bool started_{false};
+    uint32_t window_start_ms_{0};
+};
+
+}  // namespace esphome::elero
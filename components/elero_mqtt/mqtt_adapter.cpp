@@ -9,6 +9,7 @@
 #include "../elero/device_registry.h"
 #include "../elero/state_snapshot.h"  // state_change:: flags, Published types
 #include "../elero/elero_strings.h"
+#include "../elero/scene_json.h"
 #include "esphome/core/log.h"
 #include "esphome/core/application.h"
 #include "esphome/components/json/json_util.h"
@@ -46,6 +47,7 @@ void MqttAdapter::setup(DeviceRegistry &registry) {
     if (ctx_.mqtt->is_connected()) {
         start_stale_collection_();
         mqtt_was_connected_ = true;
+        registry_->refresh_interest(this);
     }
 }
 
@@ -55,23 +57,35 @@ void MqttAdapter::loop() {
     if (connected && !mqtt_was_connected_) {
         ESP_LOGI(TAG, "MQTT connected, starting stale discovery cleanup");
         start_stale_collection_();
+        mqtt_was_connected_ = true;
+        registry_->refresh_interest(this);
     }
 
     if (!connected) {
-        mqtt_was_connected_ = false;
+        if (mqtt_was_connected_) {
+            mqtt_was_connected_ = false;
+            registry_->refresh_interest(this);
+        }
         cleanup_state_ = CleanupState::IDLE;
         collected_topics_.clear();
         return;
     }
 
-    mqtt_was_connected_ = true;
-
     if (cleanup_state_ == CleanupState::COLLECTING &&
         millis() - collect_start_ms_ > STALE_COLLECT_DELAY_MS) {
         finish_stale_cleanup_();
     }
 }
 
+AdapterInterest MqttAdapter::interest() const {
+    // Disconnected: nothing to publish — reconnect republishes everything
+    if (!mqtt_was_connected_) return AdapterInterest::none();
+    AdapterInterest in;
+    in.changes = state_change::ALL & ~state_change::OPERATION;  // HA state topic carries it
+    in.rf_packets = false;
+    return in;
+}
+
 // ═══════════════════════════════════════════════════════════════════════════════
 // ADAPTER CALLBACKS
 // ═══════════════════════════════════════════════════════════════════════════════
@@ -598,6 +612,28 @@ void MqttAdapter::publish_gateway_state_() {
         payload.c_str(), false);
 }
 
+// ═══════════════════════════════════════════════════════════════════════════════
+// SCENES — hub-level JSON command topic
+// ═══════════════════════════════════════════════════════════════════════════════
+
+void MqttAdapter::subscribe_scene_commands_() {
+    ctx_.mqtt->subscribe((ctx_.topic_prefix + mqtt_topic::SCENE_SET).c_str(),
+        [this](const char *, const char *payload) {
+            if (registry_ == nullptr) return;
+            SceneResult result;
+            bool handled = json::parse_json(payload, [&](JsonObject root) -> bool {
+                result = apply_scene_json(*registry_, root);
+                return true;
+            });
+            if (!handled) {
+                ESP_LOGW(TAG, "Invalid scene payload");
+                return;
+            }
+            ctx_.mqtt->publish((ctx_.topic_prefix + mqtt_topic::SCENE_RESULT).c_str(),
+                               scene_result_json(result).c_str(), false);
+        });
+}
+
 // ═══════════════════════════════════════════════════════════════════════════════
 // STALE DISCOVERY CLEANUP
 // ═══════════════════════════════════════════════════════════════════════════════
@@ -665,6 +701,7 @@ void MqttAdapter::finish_stale_cleanup_() {
     ctx_.publish_birth();
     publish_gateway_discovery_();
     publish_gateway_state_();
+    subscribe_scene_commands_();
     republish_all_();
 
     cleanup_state_ = CleanupState::DONE;
@@ -39,12 +39,13 @@ class MqttAdapter : public OutputAdapter {
 
     void setup(DeviceRegistry &registry) override;
     void loop() override;
+    AdapterInterest interest() const override;
 
     void on_device_added(const Device &dev) override;
     void on_device_removed(const Device &dev) override;
     void on_state_changed(const Device &dev, uint16_t changes) override;
     void on_config_changed(const Device &dev) override;
-    void on_rf_packet(const RfPacketInfo &pkt) override {}  // MQTT doesn't forward raw RF
+    void on_rf_packet(const RfPacketInfo &pkt) override {}  // Not subscribed (see interest())
 
  private:
     // ── Cover helpers ──
@@ -68,6 +69,9 @@ class MqttAdapter : public OutputAdapter {
     void publish_gateway_discovery_();
     void publish_gateway_state_();
 
+    // ── Scenes ──
+    void subscribe_scene_commands_();
+
     // ── Stale discovery cleanup ──
     void start_stale_collection_();
     void finish_stale_cleanup_();
@@ -35,6 +35,8 @@ inline constexpr const char *SET = "/set";
 inline constexpr const char *SET_POSITION = "/set_position";
 inline constexpr const char *TILT = "/tilt";
 inline constexpr const char *CONFIG = "/config";
+inline constexpr const char *SCENE_SET = "/scene/set";        ///< Hub-level: {prefix}/scene/set
+inline constexpr const char *SCENE_RESULT = "/scene/result";  ///< Hub-level: {prefix}/scene/result
 }  // namespace mqtt_topic
 
 // ═══════════════════════════════════════════════════════════════════════════════
@@ -2,7 +2,13 @@ import esphome.codegen as cg
 import esphome.config_validation as cv
 from esphome.core import CORE
 
-from ..elero import CONF_ELERO_ID, CONF_REGISTRY_ID, DeviceRegistry, elero_ns
+from ..elero import (
+    CONF_ELERO_ID,
+    CONF_MAX_DEVICES,
+    CONF_REGISTRY_ID,
+    DeviceRegistry,
+    elero_ns,
+)
 
 DEPENDENCIES = ["elero"]
 AUTO_LOAD = ["json", "cover", "light"]
@@ -34,11 +40,12 @@ async def to_code(config):
 
         # Ensure cover/light framework is enabled — normally set by ESPHome when
         # YAML cover:/light: blocks exist, but NVS mode creates entities at runtime.
-        # Entity counts are set to MAX_DEVICES since the actual count isn't known at codegen.
+        # Entity counts are set to the registry capacity since the actual count isn't known at codegen.
+        max_devices = CORE.config["elero"][CONF_MAX_DEVICES]
         cg.add_define("USE_COVER")
         cg.add_define("USE_LIGHT")
-        cg.add_define("ESPHOME_ENTITY_COVER_COUNT", 48)
-        cg.add_define("ESPHOME_ENTITY_LIGHT_COUNT", 48)
+        cg.add_define("ESPHOME_ENTITY_COVER_COUNT", max_devices)
+        cg.add_define("ESPHOME_ENTITY_LIGHT_COUNT", max_devices)
 
         adapter = cg.new_Pvariable(config[CONF_NVS_ADAPTER_ID])
         cg.add(adapter.set_registry(registry))
@@ -3,6 +3,7 @@
 #include "../elero/elero_packet.h"
 #include "../elero/elero_strings.h"
 #include "../elero/nvs_config.h"
+#include "../elero/scene_json.h"
 #include "../elero/state_snapshot.h"
 #include "esphome/core/log.h"
 #include "esphome/core/application.h"
@@ -48,6 +49,20 @@ static bool parse_device_type(const char *str, DeviceType &out) {
   return false;
 }
 
+/// Link statistics and the TX parameters learned from them (see link_quality.h).
+static void add_link_json(JsonObject obj, const CommandSender &sender) {
+  const auto &link = sender.link();
+  JsonObject out = obj["link"].to<JsonObject>();
+  if (link.has_rssi())
+    out["rssi_avg"] = round_rssi(link.rssi());
+  out["response_pct"] = static_cast<int>(link.response_rate() * PERCENT_SCALE + 0.5f);
+  out["retries_avg"] = link.retries();
+  out["learned"] = link.learned();
+  out["repeats"] = link.params().repeats;
+  out["max_retries"] = link.params().max_retries;
+  out["backoff_ms"] = sender.base_backoff_ms();
+}
+
 // ═══════════════════════════════════════════════════════════════════════════════
 // Component Lifecycle
 // ═══════════════════════════════════════════════════════════════════════════════
@@ -133,29 +148,52 @@ void EleroWebServer::on_device_removed(const Device &dev) {
 void EleroWebServer::on_state_changed(const Device &dev, uint16_t /*changes*/) {
   if (this->ws_clients_.empty() || !this->enabled_)
     return;
+  if (!dev.is_cover() && !dev.is_light())
+    return;
 
   uint32_t now = millis();
-  std::string payload;
+  std::string payload = json::build_json([&](JsonObject root) { this->add_state_json_(root, dev, now); });
+  this->ws_broadcast("state_changed", payload);
+}
 
-  if (dev.is_cover()) {
-    auto snap = compute_cover_snapshot(dev, now);
-    payload = json::build_json([&](JsonObject root) {
-      root["address"] = hex_str(dev.config.dst_address);
-      root["device_type"] = device_type_str(dev.config.type);
-      snap.to_json(root);
-    });
-  } else if (dev.is_light()) {
-    auto snap = compute_light_snapshot(dev, now);
-    payload = json::build_json([&](JsonObject root) {
-      root["address"] = hex_str(dev.config.dst_address);
-      root["device_type"] = device_type_str(dev.config.type);
-      snap.to_json(root);
-    });
-  } else {
+void EleroWebServer::on_state_batch(std::span<const StateChange> batch) {
+  if (this->ws_clients_.empty() || !this->enabled_)
+    return;
+  if (batch.size() == 1) {
+    this->on_state_changed(*batch[0].device, batch[0].changes);
     return;
   }
 
-  this->ws_broadcast("state_changed", payload);
+  // One frame for the whole registry loop iteration instead of one per device
+  uint32_t now = millis();
+  bool any = false;
+  std::string payload = json::build_json([&](JsonObject root) {
+    JsonArray devices = root["devices"].to<JsonArray>();
+    for (const auto &c : batch) {
+      if (!c.device->is_cover() && !c.device->is_light())
+        continue;
+      this->add_state_json_(devices.add<JsonObject>(), *c.device, now);
+      any = true;
+    }
+  });
+  if (any)
+    this->ws_broadcast("state_batch", payload);
+}
+
+bool EleroWebServer::add_state_json_(JsonObject obj, const Device &dev, uint32_t now) {
+  if (dev.is_cover()) {
+    obj["address"] = hex_str(dev.config.dst_address);
+    obj["device_type"] = device_type_str(dev.config.type);
+    this->registry_->cover_snapshot(dev, now).to_json(obj);
+    return true;
+  }
+  if (dev.is_light()) {
+    obj["address"] = hex_str(dev.config.dst_address);
+    obj["device_type"] = device_type_str(dev.config.type);
+    this->registry_->light_snapshot(dev, now).to_json(obj);
+    return true;
+  }
+  return false;
 }
 
 // ═══════════════════════════════════════════════════════════════════════════════
@@ -280,6 +318,7 @@ void EleroWebServer::handle_ws_upgrade(struct mg_connection *c, struct mg_http_m
   mg_ws_upgrade(c, hm, nullptr);
   c->data[0] = 'W';  // Mark as WebSocket connection
   this->ws_clients_.push_back(c);
+  this->update_subscription_();
 
   ESP_LOGI(TAG, "WebSocket client connected, %d total", this->ws_clients_.size());
 
@@ -323,6 +362,14 @@ void EleroWebServer::handle_ws_message(struct mg_connection *c, struct mg_ws_mes
       return true;
     }
 
+    if (type == "scene") {
+      auto *registry = this->parent_->get_registry();
+      if (registry == nullptr) return false;
+      SceneResult result = apply_scene_json(*registry, root);
+      this->ws_send(c, "scene", scene_result_json(result));
+      return true;
+    }
+
     if (type == "upsert_device") { this->handle_upsert_device_(c, root); return true; }
     if (type == "remove_device") { this->handle_remove_device_(c, root); return true; }
     if (type == "restart") { App.safe_reboot(); return true; }
@@ -393,6 +440,33 @@ void EleroWebServer::ws_cleanup() {
       std::remove_if(this->ws_clients_.begin(), this->ws_clients_.end(),
                      [](struct mg_connection *c) { return c->is_closing || c->data[0] != 'W'; }),
       this->ws_clients_.end());
+  this->update_subscription_();
+}
+
+void EleroWebServer::update_subscription_() {
+  if (this->registry_ == nullptr)
+    return;
+  bool want = this->enabled_ && !this->ws_clients_.empty();
+  if (want == this->subscribed_)
+    return;
+  this->subscribed_ = want;
+  if (want) {
+    this->registry_->acquire_raw_capture();
+  } else {
+    this->registry_->release_raw_capture();
+  }
+  this->registry_->refresh_interest(this);
+}
+
+AdapterInterest EleroWebServer::interest() const {
+  if (!this->subscribed_)
+    return AdapterInterest::none();
+  // The state JSON carries everything but the operation (ha_state covers it);
+  // remotes have no state event in the UI
+  AdapterInterest in;
+  in.changes = state_change::ALL & ~(state_change::OPERATION | state_change::REMOTE_ACTIVITY);
+  in.device_types = AdapterInterest::type_bit(DeviceType::COVER) | AdapterInterest::type_bit(DeviceType::LIGHT);
+  return in;
 }
 
 // ═══════════════════════════════════════════════════════════════════════════════
@@ -430,7 +504,7 @@ std::string EleroWebServer::build_config_json() {
       uint32_t now = millis();
 
       registry->for_each_active(DeviceType::COVER, [&](const Device &dev) {
-        auto snap = compute_cover_snapshot(dev, now);
+        const auto &snap = registry->cover_snapshot(dev, now);
         JsonObject obj = blinds.add<JsonObject>();
         obj["address"] = hex_str(dev.config.dst_address);
         obj["name"] = dev.config.name;
@@ -442,11 +516,12 @@ std::string EleroWebServer::build_config_json() {
         obj["enabled"] = dev.config.is_enabled();
         obj["updated_at"] = dev.config.updated_at;
         snap.to_json(obj);
+        add_link_json(obj, dev.sender);
         remote_addrs.insert(dev.config.src_address);
       });
 
       registry->for_each_active(DeviceType::LIGHT, [&](const Device &dev) {
-        auto snap = compute_light_snapshot(dev, now);
+        const auto &snap = registry->light_snapshot(dev, now);
         JsonObject obj = lights_arr.add<JsonObject>();
         obj["address"] = hex_str(dev.config.dst_address);
         obj["name"] = dev.config.name;
@@ -456,6 +531,7 @@ std::string EleroWebServer::build_config_json() {
         obj["enabled"] = dev.config.is_enabled();
         obj["updated_at"] = dev.config.updated_at;
         snap.to_json(obj);
+        add_link_json(obj, dev.sender);
         remote_addrs.insert(dev.config.src_address);
       });
 
@@ -483,11 +559,14 @@ std::string EleroWebServer::build_config_json() {
 std::string EleroWebServer::build_rf_json(const RfPacketInfo &pkt) {
   // Build hex string of raw packet
   std::string raw_hex;
-  raw_hex.reserve(pkt.raw_len * 3);
-  for (int i = 0; i < pkt.raw_len && i < CC1101_FIFO_LENGTH; i++) {
-    char byte_buf[4];
-    snprintf(byte_buf, sizeof(byte_buf), i == 0 ? "%02x" : " %02x", pkt.raw[i]);
-    raw_hex += byte_buf;
+  // Empty when the frame arrived before capture was enabled or the capture ring was full
+  if (pkt.raw != nullptr) {
+    raw_hex.reserve(pkt.raw->len * 3);
+    for (int i = 0; i < pkt.raw->len && i < CC1101_FIFO_LENGTH; i++) {
+      char byte_buf[4];
+      snprintf(byte_buf, sizeof(byte_buf), i == 0 ? "%02x" : " %02x", pkt.raw->bytes[i]);
+      raw_hex += byte_buf;
+    }
   }
 
   return json::build_json([&](JsonObject root) {
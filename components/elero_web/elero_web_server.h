@@ -34,16 +34,21 @@ class EleroWebServer : public Component, public OutputAdapter, public logger::Lo
   void set_port(uint16_t port) { this->port_ = port; }
 
   // Enable/disable web UI (used by HA switch)
-  void set_enabled(bool en) { this->enabled_ = en; }
+  void set_enabled(bool en) {
+    this->enabled_ = en;
+    this->update_subscription_();
+  }
   bool is_enabled() const { return this->enabled_; }
 
   // ── OutputAdapter interface ──────────────────────────────
   // Component::setup()/loop() satisfy OutputAdapter::loop() (same signature).
   // OutputAdapter::setup(DeviceRegistry&) is a separate overload.
   void setup(DeviceRegistry &registry) override { registry_ = &registry; }
+  AdapterInterest interest() const override;
   void on_device_added(const Device &dev) override;
   void on_device_removed(const Device &dev) override;
   void on_state_changed(const Device &dev, uint16_t changes) override;
+  void on_state_batch(std::span<const StateChange> batch) override;
   void on_config_changed(const Device &dev) override;
   void on_rf_packet(const RfPacketInfo &pkt) override;
 
@@ -76,10 +81,17 @@ class EleroWebServer : public Component, public OutputAdapter, public logger::Lo
   void ws_broadcast(const char *event, const std::string &data);
   void ws_cleanup();
 
+  /// Subscribe to registry events (and hold a raw-capture reference) only
+  /// while enabled with at least one WebSocket client
+  void update_subscription_();
+  bool subscribed_{false};
+
   // JSON builders
   std::string build_config_json();
   std::string build_rf_json(const RfPacketInfo &pkt);
   std::string build_device_upserted_json_(const Device &dev);
+  /// Snapshot fields of a cover/light for "state_changed"/"state_batch". False for remotes.
+  bool add_state_json_(JsonObject obj, const Device &dev, uint32_t now);
 
   // Device CRUD handlers (MQTT mode)
   void handle_upsert_device_(struct mg_connection *c, JsonObject root);
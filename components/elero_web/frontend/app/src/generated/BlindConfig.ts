@@ -1,3 +1,4 @@
+import {LinkStats} from './LinkStats';
 
 interface BlindConfig {
   /**
@@ -67,5 +68,9 @@ interface BlindConfig {
    * @example 408
    */
   'last_seen'?: number;
+  /**
+   * Link statistics of a device and the TX parameters learned from them
+   */
+  'link'?: LinkStats;
 }
 export { BlindConfig };
\ No newline at end of file
@@ -1,3 +1,4 @@
+import {LinkStats} from './LinkStats';
 
 interface LightConfig {
   /**
@@ -57,5 +58,9 @@ interface LightConfig {
    * @example 408
    */
   'last_seen'?: number;
+  /**
+   * Link statistics of a device and the TX parameters learned from them
+   */
+  'link'?: LinkStats;
 }
 export { LightConfig };
\ No newline at end of file
@@ -0,0 +1,40 @@
+/**
+ * Link statistics of a device and the TX parameters learned from them
+ */
+interface LinkStats {
+  /**
+   * Smoothed RSSI of the device's status frames in dBm (absent until one was received)
+   * @example -72.5
+   */
+  'rssi_avg'?: number;
+  /**
+   * Smoothed share of status polls the device answered (%)
+   * @example 98
+   */
+  'response_pct': number;
+  /**
+   * Smoothed TX retries per command
+   * @example 0.1
+   */
+  'retries_avg': number;
+  /**
+   * Enough observations to adapt the parameters below (otherwise defaults)
+   */
+  'learned': boolean;
+  /**
+   * Packets sent per command
+   * @example 3
+   */
+  'repeats': number;
+  /**
+   * Failed TX attempts before a command is dropped
+   * @example 3
+   */
+  'max_retries': number;
+  /**
+   * Backoff before the first TX retry in milliseconds
+   * @example 20
+   */
+  'backoff_ms': number;
+}
+export { LinkStats };
\ No newline at end of file
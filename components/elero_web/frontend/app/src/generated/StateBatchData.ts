@@ -0,0 +1,5 @@
+import {StateChangedData} from './StateChangedData';
+interface StateBatchData {
+  'devices': StateChangedData[];
+}
+export { StateBatchData };
\ No newline at end of file
@@ -0,0 +1,6 @@
+import {StateBatchData} from './StateBatchData';
+interface StateBatchEnvelope {
+  'event': 'state_batch';
+  'data': StateBatchData;
+}
+export { StateBatchEnvelope };
\ No newline at end of file
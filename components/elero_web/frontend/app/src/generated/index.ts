@@ -16,6 +16,7 @@ export type { HaCoverState } from './HaCoverState'
 export type { HubConfig } from './HubConfig'
 export type { HubMode } from './HubMode'
 export type { LightConfig } from './LightConfig'
+export type { LinkStats } from './LinkStats'
 export type { ProblemType } from './ProblemType'
 export type { RadioConfig } from './RadioConfig'
 export type { RawPayload } from './RawPayload'
@@ -25,6 +26,8 @@ export type { RestartPayload } from './RestartPayload'
 export type { RfData } from './RfData'
 export type { RfEventEnvelope } from './RfEventEnvelope'
 export type { RfStateName } from './RfStateName'
+export type { StateBatchData } from './StateBatchData'
+export type { StateBatchEnvelope } from './StateBatchEnvelope'
 export type { StateChangedData } from './StateChangedData'
 export type { StateChangedEnvelope } from './StateChangedEnvelope'
 export type { UpsertDevicePayload } from './UpsertDevicePayload'
@@ -1,4 +1,4 @@
-import type { CmdPayload, RawPayload, UpsertDevicePayload, RemoveDevicePayload, RestartPayload, DeviceAction, StateChangedData } from '@/generated'
+import type { CmdPayload, RawPayload, UpsertDevicePayload, RemoveDevicePayload, RestartPayload, DeviceAction, StateChangedData, StateBatchData } from '@/generated'
 import {
   setConnected, setDevices, addRfPacket,
   onDeviceUpserted, onDeviceRemoved, onStateChanged,
@@ -48,6 +48,8 @@ export function initWs() {
       addRfPacket(data)
     } else if (event === 'state_changed') {
       onStateChanged(data as StateChangedData)
+    } else if (event === 'state_batch') {
+      for (const d of (data as StateBatchData).devices) onStateChanged(d)
     } else if (event === 'device_upserted') {
       onDeviceUpserted(data)
     } else if (event === 'device_removed') {
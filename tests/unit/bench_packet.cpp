@@ -0,0 +1,214 @@
+/// @file bench_packet.cpp
+/// @brief Google Benchmark microbenchmarks for the packet codec (RF task hot path).
+///
+/// Every function here runs on Core 0 for each packet received or sent. Each
+/// benchmark is registered once per vector in test_vectors.h, so results are
+/// keyed by "<function>/<vector>" and can be diffed between commits:
+///
+///   cmake --build build --target bench_packet_json
+///   # → build/bench_packet.json
+///
+/// bytes_per_op is the number of input bytes one iteration touches;
+/// bytes_per_second is derived from it by Google Benchmark.
+
+#include <benchmark/benchmark.h>
+#include <cstring>
+#include <string>
+#include "elero/elero_packet.h"
+#include "elero/elero_protocol.h"
+#include "elero/cc1101_compat.h"
+#include "test_vectors.h"
+
+using namespace esphome::elero;
+using namespace esphome::elero::packet;
+using esphome::elero::test_vectors::PacketVector;
+using esphome::elero::test_vectors::ALL_VECTORS;
+
+namespace {
+
+constexpr size_t ENCRYPTED_LEN = 8;  ///< msg_decode/msg_encode section size
+
+void set_bytes(benchmark::State &state, size_t bytes) {
+  state.SetBytesProcessed(static_cast<int64_t>(state.iterations()) * static_cast<int64_t>(bytes));
+  state.counters["bytes_per_op"] = static_cast<double>(bytes);
+}
+
+/// Offset of the 8-byte encrypted section, or the start of the buffer for
+/// vectors that do not parse (the codec itself does not care).
+size_t encrypted_offset(const PacketVector &vec) {
+  auto r = parse_packet(vec.raw, vec.raw_len);
+  if (!r.valid) return 0;
+  return pkt_offset::FIRST_DEST + 2 + r.dests_len;
+}
+
+// ─── Parse ──────────────────────────────────────────────────────────────────
+
+void bm_parse_packet(benchmark::State &state, const PacketVector *vec) {
+  for (auto _ : state) {
+    auto r = parse_packet(vec->raw, vec->raw_len);
+    benchmark::DoNotOptimize(r);
+  }
+  set_bytes(state, vec->raw_len);
+}
+
+// ─── Encrypted section ──────────────────────────────────────────────────────
+
+void bm_msg_decode(benchmark::State &state, const PacketVector *vec) {
+  uint8_t buf[ENCRYPTED_LEN];
+  const uint8_t *src = vec->raw + encrypted_offset(*vec);
+  for (auto _ : state) {
+    memcpy(buf, src, ENCRYPTED_LEN);
+    protocol::msg_decode(buf);
+    benchmark::DoNotOptimize(buf);
+    benchmark::ClobberMemory();
+  }
+  set_bytes(state, ENCRYPTED_LEN);
+}
+
+void bm_msg_encode(benchmark::State &state, const PacketVector *vec) {
+  // Encode the plaintext the vector decodes to, so both directions see the same data
+  uint8_t plain[ENCRYPTED_LEN];
+  memcpy(plain, vec->raw + encrypted_offset(*vec), ENCRYPTED_LEN);
+  protocol::msg_decode(plain);
+  uint8_t buf[ENCRYPTED_LEN];
+  for (auto _ : state) {
+    memcpy(buf, plain, ENCRYPTED_LEN);
+    protocol::msg_encode(buf);
+    benchmark::DoNotOptimize(buf);
+    benchmark::ClobberMemory();
+  }
+  set_bytes(state, ENCRYPTED_LEN);
+}
+
+void bm_payload_cache(benchmark::State &state, const PacketVector *vec) {
+  auto r = parse_packet(vec->raw, vec->raw_len);
+  const uint8_t cmd = r.payload[payload_offset::COMMAND];
+  uint8_t buf[ENCRYPTED_LEN];
+  for (auto _ : state) {
+    write_encrypted_payload(buf, r.counter, cmd);
+    benchmark::DoNotOptimize(buf);
+    benchmark::ClobberMemory();
+  }
+  set_bytes(state, ENCRYPTED_LEN);
+}
+
+// ─── SX12xx software CRC / whitening ────────────────────────────────────────
+
+void bm_crc16(benchmark::State &state, const PacketVector *vec) {
+  for (auto _ : state) {
+    uint16_t crc = cc1101_crc16(vec->raw, vec->raw_len);
+    benchmark::DoNotOptimize(crc);
+  }
+  set_bytes(state, vec->raw_len);
+}
+
+void bm_pn9_whiten(benchmark::State &state, const PacketVector *vec) {
+  uint8_t buf[FIFO_LENGTH];
+  size_t len = vec->raw_len < sizeof(buf) ? vec->raw_len : sizeof(buf);
+  memcpy(buf, vec->raw, len);
+  for (auto _ : state) {
+    cc1101_pn9_whiten(buf, len);
+    benchmark::DoNotOptimize(buf);
+    benchmark::ClobberMemory();
+  }
+  set_bytes(state, len);
+}
+
+// ─── Builders (parameters taken from each valid vector) ─────────────────────
+
+void bm_build_tx_packet(benchmark::State &state, const PacketVector *vec) {
+  auto r = parse_packet(vec->raw, vec->raw_len);
+  TxParams params;
+  params.counter = r.counter;
+  params.dst_addr = r.dst_addr;
+  params.src_addr = r.src_addr;
+  params.channel = r.channel;
+  params.type = is_status_packet(r.type) ? r.type : msg_type::COMMAND;
+  params.command = r.payload[payload_offset::COMMAND];
+  params.state = r.state;
+  uint8_t buf[FIFO_LENGTH];
+  size_t len = 0;
+  for (auto _ : state) {
+    len = build_tx_packet(params, buf);
+    benchmark::DoNotOptimize(buf);
+    benchmark::ClobberMemory();
+  }
+  set_bytes(state, len);
+}
+
+void bm_build_button_packet(benchmark::State &state, const PacketVector *vec) {
+  auto r = parse_packet(vec->raw, vec->raw_len);
+  ButtonTxParams params;
+  params.counter = r.counter;
+  params.src_addr = r.src_addr;
+  params.channel = r.channel;
+  params.command = r.payload[payload_offset::COMMAND];
+  uint8_t buf[FIFO_LENGTH];
+  size_t len = 0;
+  for (auto _ : state) {
+    len = build_button_packet(params, buf);
+    benchmark::DoNotOptimize(buf);
+    benchmark::ClobberMemory();
+  }
+  set_bytes(state, len);
+}
+
+void bm_build_group_button_packet(benchmark::State &state, const PacketVector *vec) {
+  auto r = parse_packet(vec->raw, vec->raw_len);
+  uint8_t channels[GROUP_MAX_DESTS];
+  for (uint8_t i = 0; i < GROUP_MAX_DESTS; ++i) channels[i] = i + 1;
+  GroupButtonTxParams params;
+  params.counter = r.counter;
+  params.src_addr = r.src_addr;
+  params.command = r.payload[payload_offset::COMMAND];
+  params.num_dests = static_cast<uint8_t>(state.range(0));
+  params.dest_channels = channels;
+  uint8_t buf[FIFO_LENGTH];
+  size_t len = 0;
+  for (auto _ : state) {
+    len = build_group_button_packet(params, buf);
+    benchmark::DoNotOptimize(buf);
+    benchmark::ClobberMemory();
+  }
+  set_bytes(state, len);
+}
+
+void register_all() {
+  for (const auto *vec : ALL_VECTORS) {
+    const std::string name = vec->name;
+    benchmark::RegisterBenchmark(("parse_packet/" + name).c_str(), bm_parse_packet, vec);
+
+    // Byte-level codecs run on whatever is on the air, valid or not
+    if (vec->raw == nullptr) continue;
+    benchmark::RegisterBenchmark(("cc1101_crc16/" + name).c_str(), bm_crc16, vec);
+    benchmark::RegisterBenchmark(("cc1101_pn9_whiten/" + name).c_str(), bm_pn9_whiten, vec);
+    if (vec->raw_len < ENCRYPTED_LEN) continue;
+    benchmark::RegisterBenchmark(("msg_decode/" + name).c_str(), bm_msg_decode, vec);
+    benchmark::RegisterBenchmark(("msg_encode/" + name).c_str(), bm_msg_encode, vec);
+
+    // Builders need real header fields
+    if (!vec->expect_valid) continue;
+    if (!is_status_packet(vec->exp_type)) {
+      benchmark::RegisterBenchmark(("payload_cache/" + name).c_str(), bm_payload_cache, vec);
+    }
+    benchmark::RegisterBenchmark(("build_tx_packet/" + name).c_str(), bm_build_tx_packet, vec);
+    benchmark::RegisterBenchmark(("build_button_packet/" + name).c_str(), bm_build_button_packet, vec);
+    benchmark::RegisterBenchmark(("build_group_button_packet/" + name).c_str(), bm_build_group_button_packet, vec)
+        ->Arg(2)
+        ->Arg(8)
+        ->Arg(GROUP_MAX_DESTS);
+  }
+}
+
+}  // namespace
+
+int main(int argc, char **argv) {
+  register_all();
+  // Memory footprint of precomputed tables (flash on ESP32, 0 bytes RAM)
+  benchmark::AddCustomContext("payload_cache_flash_bytes", std::to_string(payload_cache::FLASH_BYTES));
+  benchmark::Initialize(&argc, argv);
+  if (benchmark::ReportUnrecognizedArguments(argc, argv)) return 1;
+  benchmark::RunSpecifiedBenchmarks();
+  benchmark::Shutdown();
+  return 0;
+}
@@ -80,6 +80,72 @@ TEST(PN9Whitening, WhitenedEleroPacket) {
   EXPECT_EQ(memcmp(raw, expected_whitened, 30), 0);
 }
 
+namespace {
+
+/// Bit-serial reference LFSR (the original implementation).
+void pn9_reference(uint8_t *data, size_t len) {
+  uint16_t key = 0x1FF;
+  for (size_t i = 0; i < len; ++i) {
+    data[i] ^= key & 0xFF;
+    for (int j = 0; j < 8; ++j) {
+      uint16_t msb = ((key >> 5) ^ (key >> 0)) & 1;
+      key = (key >> 1) | (msb << 8);
+    }
+  }
+}
+
+/// Bit-serial reference CRC-16/0x8005 (the original implementation).
+uint16_t crc16_reference(const uint8_t *data, size_t len) {
+  uint16_t crc = 0xFFFF;
+  for (size_t i = 0; i < len; ++i) {
+    crc ^= static_cast<uint16_t>(data[i]) << 8;
+    for (int bit = 0; bit < 8; ++bit) {
+      if (crc & 0x8000) {
+        crc = (crc << 1) ^ 0x8005;
+      } else {
+        crc <<= 1;
+      }
+    }
+  }
+  return crc;
+}
+
+}  // namespace
+
+TEST(PN9Whitening, KeystreamTableMatchesLfsr) {
+  uint8_t ref[pn9::KEYSTREAM_LEN] = {};
+  pn9_reference(ref, sizeof(ref));
+  EXPECT_EQ(memcmp(pn9::KEYSTREAM.data(), ref, sizeof(ref)), 0);
+}
+
+TEST(PN9Whitening, MatchesLfsrForAllLengthsAndAlignments) {
+  // Word-wide XOR must not depend on buffer alignment, and lengths past
+  // the 64-byte table must continue the sequence seamlessly.
+  for (size_t align = 0; align < 4; ++align) {
+    for (size_t len = 0; len <= 200; ++len) {
+      std::vector<uint8_t> storage(len + 4), ref(len);
+      for (size_t i = 0; i < len; ++i) ref[i] = static_cast<uint8_t>(i * 37 + 11);
+      uint8_t *buf = storage.data() + align;
+      memcpy(buf, ref.data(), len);
+
+      cc1101_pn9_whiten(buf, len);
+      pn9_reference(ref.data(), len);
+      ASSERT_EQ(memcmp(buf, ref.data(), len), 0) << "len " << len << " align " << align;
+    }
+  }
+}
+
+TEST(PN9Whitening, OffsetContinuesKeystream) {
+  // De-whitening [0, 1) then [1, n) equals de-whitening [0, n) in one go
+  for (size_t split : {1u, 3u, 5u, 63u, 64u, 65u, 100u}) {
+    uint8_t whole[128] = {}, parts[128] = {};
+    cc1101_pn9_whiten(whole, sizeof(whole));
+    cc1101_pn9_whiten(parts, split);
+    cc1101_pn9_whiten_from(parts + split, sizeof(parts) - split, split);
+    ASSERT_EQ(memcmp(whole, parts, sizeof(whole)), 0) << "split " << split;
+  }
+}
+
 // ═══════════════════════════════════════════════════════════════════════════════
 // CRC-16
 // ═══════════════════════════════════════════════════════════════════════════════
@@ -131,6 +197,44 @@ TEST(CRC16, DifferentData) {
   EXPECT_NE(cc1101_crc16(packet_a, 3), cc1101_crc16(packet_b, 3));
 }
 
+TEST(CRC16, TableMatchesBitSerial) {
+  uint8_t data[64];
+  for (size_t i = 0; i < sizeof(data); ++i) data[i] = static_cast<uint8_t>(i * 73 + 5);
+  for (size_t len = 0; len <= sizeof(data); ++len) {
+    ASSERT_EQ(cc1101_crc16(data, len), crc16_reference(data, len)) << "len " << len;
+  }
+  for (int b = 0; b < 256; ++b) {
+    uint8_t byte = static_cast<uint8_t>(b);
+    ASSERT_EQ(cc1101_crc16(&byte, 1), crc16_reference(&byte, 1)) << "byte " << b;
+  }
+}
+
+TEST(CRC16, CrcOkAcceptsValidFrame) {
+  // 0x1B button packet + CRC from the firmware TX log
+  const uint8_t frame[] = {
+      0x1B, 0x01, 0x44, 0x10, 0x00, 0x01, 0x03, 0x4F,
+      0xCA, 0x30, 0x4F, 0xCA, 0x30, 0x4F, 0xCA, 0x30,
+      0x01, 0x03, 0x00, 0x03, 0x54, 0xF4, 0x1E, 0xBC,
+      0x6C, 0xDE, 0xA4, 0xB2, 0xBE, 0x64};
+  EXPECT_TRUE(cc1101_crc_ok(frame, sizeof(frame)));
+}
+
+TEST(CRC16, CrcOkRejectsEverySingleBitFlip) {
+  uint8_t frame[] = {
+      0x1B, 0x01, 0x44, 0x10, 0x00, 0x01, 0x03, 0x4F,
+      0xCA, 0x30, 0x4F, 0xCA, 0x30, 0x4F, 0xCA, 0x30,
+      0x01, 0x03, 0x00, 0x03, 0x54, 0xF4, 0x1E, 0xBC,
+      0x6C, 0xDE, 0xA4, 0xB2, 0xBE, 0x64};
+  for (size_t i = 0; i < sizeof(frame); ++i) {
+    for (int bit = 0; bit < 8; ++bit) {
+      frame[i] ^= (1 << bit);
+      EXPECT_FALSE(cc1101_crc_ok(frame, sizeof(frame))) << "byte " << i << " bit " << bit;
+      frame[i] ^= (1 << bit);
+    }
+  }
+  EXPECT_FALSE(cc1101_crc_ok(frame, 2));
+}
+
 // ═══════════════════════════════════════════════════════════════════════════════
 // FULL TX PIPELINE: CRC + WHITENING
 // ═══════════════════════════════════════════════════════════════════════════════
@@ -106,6 +106,34 @@ class MockElero {
   }
 };
 
+/// Mock hub with RF task burst support (like Elero::request_tx_burst).
+/// CommandSender hands it all remaining packets of a command at once.
+class BurstMockElero {
+ public:
+  struct Burst { uint8_t packets; uint8_t gap_ms; uint8_t counter; };
+  std::vector<Burst> recorded_bursts;
+  TxClient* pending_client{nullptr};
+
+  bool request_tx(TxClient*, const EleroCommand&) {
+    ADD_FAILURE() << "request_tx() used although request_tx_burst() is available";
+    return false;
+  }
+
+  bool request_tx_burst(TxClient* client, const EleroCommand& cmd, uint8_t packets, uint8_t gap_ms) {
+    recorded_bursts.push_back({packets, gap_ms, cmd.counter});
+    pending_client = client;
+    return true;
+  }
+
+  void complete_burst(uint8_t ok_mask) {
+    if (pending_client != nullptr) {
+      TxClient* client = pending_client;
+      pending_client = nullptr;
+      client->on_tx_burst_complete({recorded_bursts.back().packets, ok_mask});
+    }
+  }
+};
+
 }  // namespace elero
 }  // namespace esphome
 
@@ -254,6 +282,53 @@ TEST_F(CommandSenderTest, DropsCommandAfterMaxRetries) {
   EXPECT_FALSE(sender_.has_pending_commands());
 }
 
+// ============================================================================
+// Link Adaptation Tests
+// ============================================================================
+
+static void learn_link(LinkQuality &link, float rssi, uint8_t retries) {
+  for (int i = 0; i < 2 * link_q::MIN_SAMPLES; ++i) {
+    link.on_rssi(rssi);
+    link.on_check_answered();
+    link.on_command_done(retries);
+  }
+}
+
+TEST_F(CommandSenderTest, StrongLinkSendsLearnedRepeats) {
+  learn_link(sender_.link(), -50.0f, 0);
+  ASSERT_EQ(sender_.link().params().repeats, link_q::MIN_REPEATS);
+
+  sender_.enqueue(packet::command::UP);                          // learned count
+  sender_.enqueue(packet::command::CHECK, 1, packet::msg_type::COMMAND);  // explicit count
+  for (int i = 0; i < link_q::MIN_REPEATS + 1; ++i) {
+    mock_time_.advance(packet::button::INTER_PACKET_MS);
+    sender_.process_queue(mock_time_.millis(), &mock_hub_, "test");
+    mock_hub_.complete_tx(true);
+  }
+  ASSERT_EQ(mock_hub_.recorded_requests.size(), static_cast<size_t>(link_q::MIN_REPEATS + 1));
+  EXPECT_EQ(std::get<2>(mock_hub_.recorded_requests[1]), packet::command::UP);
+  EXPECT_EQ(std::get<2>(mock_hub_.recorded_requests[2]), packet::command::CHECK);
+  EXPECT_FALSE(sender_.is_busy());
+}
+
+TEST_F(CommandSenderTest, WeakLinkRetriesLongerWithMoreBackoff) {
+  learn_link(sender_.link(), -95.0f, 0);
+  uint8_t max_retries = sender_.link().params().max_retries;
+  ASSERT_GT(max_retries, packet::limits::SEND_RETRIES);
+  EXPECT_EQ(sender_.base_backoff_ms(), packet::button::INTER_PACKET_MS << 2);
+
+  // SEND_RETRIES + 1 failures drop a command at the default limit
+  sender_.enqueue(packet::command::UP);
+  for (int i = 0; i < packet::limits::SEND_RETRIES + 1; i++) {
+    mock_time_.advance(packet::timing::MAX_BACKOFF_MS);
+    sender_.process_queue(mock_time_.millis(), &mock_hub_, "test");
+    if (mock_hub_.pending_client != nullptr)
+      mock_hub_.complete_tx(false);
+  }
+  // Past the default retry limit, but the weak link still allows more
+  EXPECT_TRUE(sender_.has_pending_commands());
+}
+
 // ============================================================================
 // Cancellation Tests
 // ============================================================================
@@ -988,6 +1063,100 @@ TEST_F(CommandSenderTest, CounterWrapsAtMax) {
   EXPECT_EQ(sender_.command().counter, 1u);
 }
 
+// ============================================================================
+// Burst Tests (hub repeats packets on the RF task)
+// ============================================================================
+
+TEST_F(CommandSenderTest, Burst_OneRequestPerCommand) {
+  BurstMockElero hub;
+  uint8_t counter = sender_.command().counter;
+  sender_.enqueue(packet::command::UP);
+
+  mock_time_.advance(packet::button::INTER_PACKET_MS);
+  sender_.process_queue(mock_time_.millis(), &hub, "test");
+  ASSERT_EQ(hub.recorded_bursts.size(), 1u);
+  EXPECT_EQ(hub.recorded_bursts[0].packets, packet::button::PACKETS);
+  EXPECT_EQ(hub.recorded_bursts[0].gap_ms, packet::button::INTER_PACKET_MS);
+  EXPECT_EQ(sender_.state(), CommandSender::State::TX_PENDING);
+
+  hub.complete_burst(0b111);
+  EXPECT_EQ(sender_.state(), CommandSender::State::IDLE);
+  EXPECT_EQ(sender_.command().counter, counter + 1);
+  EXPECT_EQ(hub.recorded_bursts.size(), 1u);
+}
+
+TEST_F(CommandSenderTest, Burst_PartialFailureResendsRemainder) {
+  BurstMockElero hub;
+  sender_.enqueue(packet::command::UP);
+
+  mock_time_.advance(packet::button::INTER_PACKET_MS);
+  sender_.process_queue(mock_time_.millis(), &hub, "test");
+  hub.complete_burst(0b001);  // Only the first of 3 packets went out
+  EXPECT_EQ(sender_.state(), CommandSender::State::WAIT_DELAY);
+
+  // Retry after backoff carries only the 2 missing packets, same counter
+  mock_time_.advance(BACKOFF_RETRY_1);
+  sender_.process_queue(mock_time_.millis(), &hub, "test");
+  ASSERT_EQ(hub.recorded_bursts.size(), 2u);
+  EXPECT_EQ(hub.recorded_bursts[1].packets, packet::button::PACKETS - 1);
+  EXPECT_EQ(hub.recorded_bursts[1].counter, hub.recorded_bursts[0].counter);
+
+  hub.complete_burst(0b11);
+  EXPECT_EQ(sender_.state(), CommandSender::State::IDLE);
+}
+
+TEST_F(CommandSenderTest, Burst_RepeatsLearnedBelowSentCompleteCommand) {
+  BurstMockElero hub;
+  sender_.enqueue(packet::command::UP);
+  mock_time_.advance(packet::button::INTER_PACKET_MS);
+  sender_.process_queue(mock_time_.millis(), &hub, "test");
+  hub.complete_burst(0b011);  // 2 of 3 packets went out
+  ASSERT_EQ(sender_.state(), CommandSender::State::WAIT_DELAY);
+
+  // A strong link learned meanwhile needs only MIN_REPEATS — already sent
+  for (int i = 0; i < link_q::MIN_SAMPLES; ++i) sender_.link().on_rssi(-40.0f);
+  ASSERT_EQ(sender_.link().params().repeats, link_q::MIN_REPEATS);
+
+  mock_time_.advance(packet::timing::MAX_BACKOFF_MS);
+  sender_.process_queue(mock_time_.millis(), &hub, "test");
+  EXPECT_EQ(hub.recorded_bursts.size(), 1u);  // No 0-packet (or wrapped) burst
+  EXPECT_EQ(sender_.state(), CommandSender::State::IDLE);
+  EXPECT_FALSE(sender_.is_busy());
+}
+
+TEST_F(CommandSenderTest, Burst_CompletionAfterCancelIgnored) {
+  BurstMockElero hub;
+  sender_.enqueue(packet::command::UP);
+  mock_time_.advance(packet::button::INTER_PACKET_MS);
+  sender_.process_queue(mock_time_.millis(), &hub, "test");
+
+  sender_.clear_queue();
+  hub.complete_burst(0b111);
+  EXPECT_EQ(sender_.state(), CommandSender::State::IDLE);
+  EXPECT_FALSE(sender_.is_busy());
+}
+
+TEST_F(CommandSenderTest, SkipPending_DropsWithdrawnCommandWithoutRetry) {
+  (void) sender_.enqueue(packet::command::CHECK, packet::limits::CHECK_PACKETS, packet::msg_type::COMMAND);
+  (void) sender_.enqueue(packet::command::UP);
+  mock_time_.advance(packet::button::INTER_PACKET_MS);
+  sender_.process_queue(mock_time_.millis(), &mock_hub_, "test");
+  ASSERT_EQ(sender_.state(), CommandSender::State::TX_PENDING);
+  uint8_t counter = sender_.command().counter;
+
+  // Withdrawn before it aired: no retry, the counter is not spent
+  sender_.skip_pending();
+  EXPECT_EQ(sender_.state(), CommandSender::State::WAIT_DELAY);
+  EXPECT_EQ(sender_.queue_size(), 1u);
+
+  mock_time_.advance(packet::button::INTER_PACKET_MS);
+  sender_.process_queue(mock_time_.millis(), &mock_hub_, "test");
+  ASSERT_EQ(mock_hub_.recorded_commands.size(), 2u);
+  EXPECT_EQ(mock_hub_.recorded_commands[1].payload[4], packet::command::UP);
+  EXPECT_EQ(mock_hub_.recorded_commands[1].counter, counter);
+  EXPECT_EQ(sender_.state(), CommandSender::State::TX_PENDING);
+}
+
 // ============================================================================
 // Main
 // ============================================================================
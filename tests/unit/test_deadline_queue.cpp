@@ -0,0 +1,154 @@
+/// @file test_deadline_queue.cpp
+/// @brief Unit tests for the DeviceRegistry per-slot deadline heap.
+
+#include <gtest/gtest.h>
+#include <map>
+#include <random>
+
+#include "elero/deadline_queue.h"
+
+using namespace esphome::elero;
+
+using Queue = DeadlineQueue<48>;
+
+TEST(DeadlineQueue, PopDueReturnsOnlyExpiredInDeadlineOrder) {
+    Queue q;
+    q.schedule(5, 300);
+    q.schedule(1, 100);
+    q.schedule(9, 200);
+
+    uint32_t at = 0;
+    ASSERT_TRUE(q.next_deadline(at));
+    EXPECT_EQ(at, 100u);
+
+    uint8_t out[48];
+    ASSERT_EQ(q.pop_due(200, out), 2u);
+    EXPECT_EQ(out[0], 1);
+    EXPECT_EQ(out[1], 9);
+    EXPECT_FALSE(q.contains(1));
+    EXPECT_TRUE(q.contains(5));
+    EXPECT_EQ(q.pop_due(299, out), 0u);
+}
+
+TEST(DeadlineQueue, ScheduleMovesExistingEntry) {
+    Queue q;
+    q.schedule(2, 100);
+    q.schedule(3, 200);
+    q.schedule(2, 500);  // later
+    EXPECT_EQ(q.size(), 2u);
+
+    uint32_t at = 0;
+    ASSERT_TRUE(q.next_deadline(at));
+    EXPECT_EQ(at, 200u);
+
+    q.schedule(2, 50);  // earlier again
+    ASSERT_TRUE(q.next_deadline(at));
+    EXPECT_EQ(at, 50u);
+}
+
+TEST(DeadlineQueue, ScheduleEarlierNeverDelays) {
+    Queue q;
+    q.schedule(4, 100);
+    q.schedule_earlier(4, 300);
+
+    uint32_t at = 0;
+    ASSERT_TRUE(q.next_deadline(at));
+    EXPECT_EQ(at, 100u);
+
+    q.schedule_earlier(4, 40);
+    ASSERT_TRUE(q.next_deadline(at));
+    EXPECT_EQ(at, 40u);
+}
+
+TEST(DeadlineQueue, CancelKeepsHeapOrder) {
+    Queue q;
+    for (uint8_t id = 0; id < 10; ++id) q.schedule(id, 1000 - id * 10);
+    q.cancel(9);  // current minimum
+    q.cancel(4);
+    q.cancel(4);  // idempotent
+    EXPECT_EQ(q.size(), 8u);
+
+    uint8_t out[48];
+    ASSERT_EQ(q.pop_due(UINT32_MAX / 2, out), 8u);
+    for (size_t i = 1; i < 8; ++i) EXPECT_GT(out[i - 1], out[i]);  // later ids = earlier deadlines
+    EXPECT_TRUE(q.empty());
+
+    uint32_t at = 0;
+    EXPECT_FALSE(q.next_deadline(at));
+}
+
+TEST(DeadlineQueue, DeadlinesAcrossMillisWrap) {
+    Queue q;
+    q.schedule(1, 0x00000010u);  // after the wrap
+    q.schedule(2, 0xFFFFFFF0u);  // before the wrap
+
+    uint32_t at = 0;
+    ASSERT_TRUE(q.next_deadline(at));
+    EXPECT_EQ(at, 0xFFFFFFF0u);
+
+    uint8_t out[48];
+    ASSERT_EQ(q.pop_due(0xFFFFFFFFu, out), 1u);
+    EXPECT_EQ(out[0], 2);
+    ASSERT_EQ(q.pop_due(0x00000010u, out), 1u);
+    EXPECT_EQ(out[0], 1);
+}
+
+TEST(DeadlineQueue, OutOfRangeIdIgnored) {
+    Queue q;
+    q.schedule(48, 10);
+    q.cancel(48);
+    EXPECT_TRUE(q.empty());
+    EXPECT_FALSE(q.contains(48));
+}
+
+TEST(DeadlineQueue, RandomChurnMatchesReference) {
+    Queue q;
+    std::map<uint8_t, uint32_t> ref;
+    std::mt19937 rng(12345);
+    uint32_t now = 0;
+
+    for (int step = 0; step < 5000; ++step) {
+        auto id = static_cast<uint8_t>(rng() % 48);
+        switch (rng() % 4) {
+            case 0:
+            case 1: {
+                uint32_t at = now + rng() % 1000;
+                q.schedule(id, at);
+                ref[id] = at;
+                break;
+            }
+            case 2:
+                q.cancel(id);
+                ref.erase(id);
+                break;
+            default: {
+                now += rng() % 200;
+                uint8_t out[48];
+                size_t n = q.pop_due(now, out);
+                size_t expected = 0;
+                for (auto it = ref.begin(); it != ref.end();) {
+                    if (it->second <= now) {
+                        ++expected;
+                        it = ref.erase(it);
+                    } else {
+                        ++it;
+                    }
+                }
+                ASSERT_EQ(n, expected);
+                for (size_t i = 0; i < n; ++i) EXPECT_FALSE(q.contains(out[i]));
+                break;
+            }
+        }
+        ASSERT_EQ(q.size(), ref.size());
+    }
+}
+
+TEST(EarliestDeadline, PicksMinimumWrapSafe) {
+    EarliestDeadline e;
+    EXPECT_FALSE(e.set);
+    e.consider(500);
+    e.consider(0xFFFFFF00u);  // 0x100 before 0 → earlier than 500
+    e.consider(700);
+    EXPECT_TRUE(e.set);
+    EXPECT_EQ(e.ms, 0xFFFFFF00u);
+}
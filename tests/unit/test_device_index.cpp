@@ -0,0 +1,94 @@
+/// @file test_device_index.cpp
+/// @brief Unit tests for the DeviceRegistry (address, type) hash index.
+
+#include <gtest/gtest.h>
+#include <map>
+#include <utility>
+
+#include "elero/device_index.h"
+
+using namespace esphome::elero;
+
+using Index = DeviceIndex<48>;
+
+TEST(DeviceIndex, BucketsAtMostHalfFull) {
+    EXPECT_EQ(Index::BUCKETS, 128u);
+    EXPECT_EQ(DeviceIndex<64>::BUCKETS, 128u);
+    EXPECT_EQ(DeviceIndex<1>::BUCKETS, 2u);
+}
+
+TEST(DeviceIndex, InsertFindErase) {
+    Index idx;
+    EXPECT_EQ(idx.find(0xA831E5, DeviceType::COVER), Index::NOT_FOUND);
+    EXPECT_TRUE(idx.insert(0xA831E5, DeviceType::COVER, 3));
+    EXPECT_EQ(idx.find(0xA831E5, DeviceType::COVER), 3);
+    EXPECT_EQ(idx.size(), 1u);
+    EXPECT_TRUE(idx.erase(0xA831E5, DeviceType::COVER));
+    EXPECT_EQ(idx.find(0xA831E5, DeviceType::COVER), Index::NOT_FOUND);
+    EXPECT_FALSE(idx.erase(0xA831E5, DeviceType::COVER));
+    EXPECT_EQ(idx.size(), 0u);
+}
+
+TEST(DeviceIndex, TypeIsPartOfTheKey) {
+    Index idx;
+    EXPECT_TRUE(idx.insert(0xA831E5, DeviceType::COVER, 0));
+    EXPECT_TRUE(idx.insert(0xA831E5, DeviceType::REMOTE, 1));
+    EXPECT_EQ(idx.find(0xA831E5, DeviceType::COVER), 0);
+    EXPECT_EQ(idx.find(0xA831E5, DeviceType::REMOTE), 1);
+    EXPECT_EQ(idx.find(0xA831E5, DeviceType::LIGHT), Index::NOT_FOUND);
+}
+
+TEST(DeviceIndex, DuplicateInsertKeepsFirst) {
+    Index idx;
+    EXPECT_TRUE(idx.insert(0x100000, DeviceType::LIGHT, 4));
+    EXPECT_FALSE(idx.insert(0x100000, DeviceType::LIGHT, 9));
+    EXPECT_EQ(idx.find(0x100000, DeviceType::LIGHT), 4);
+}
+
+TEST(DeviceIndex, RejectsOutOfRangeSlot) {
+    Index idx;
+    EXPECT_FALSE(idx.insert(0x100000, DeviceType::COVER, 48));
+    EXPECT_EQ(idx.size(), 0u);
+}
+
+TEST(DeviceIndex, FullTableAllFindable) {
+    Index idx;
+    for (uint8_t i = 0; i < 48; ++i) ASSERT_TRUE(idx.insert(0x100000 + i, DeviceType::COVER, i));
+    for (uint8_t i = 0; i < 48; ++i) EXPECT_EQ(idx.find(0x100000 + i, DeviceType::COVER), i);
+}
+
+TEST(DeviceIndex, RandomChurnMatchesReferenceMap) {
+    // Backward-shift deletion must keep every probe run intact
+    Index idx;
+    std::map<std::pair<uint32_t, DeviceType>, uint8_t> ref;
+    uint32_t rng = 12345;
+    auto next = [&rng] { rng ^= rng << 13; rng ^= rng >> 17; rng ^= rng << 5; return rng; };
+
+    for (int step = 0; step < 20000; ++step) {
+        uint32_t addr = 0xA00000 + next() % 96;  // Dense range → many collisions
+        auto type = static_cast<DeviceType>(next() % 3);
+        auto key = std::make_pair(addr, type);
+        auto it = ref.find(key);
+        if (it != ref.end()) {
+            ASSERT_TRUE(idx.erase(addr, type));
+            ref.erase(it);
+        } else if (ref.size() < 48) {
+            auto slot = static_cast<uint8_t>(next() % 48);
+            ASSERT_TRUE(idx.insert(addr, type, slot));
+            ref[key] = slot;
+        }
+        ASSERT_EQ(idx.size(), ref.size());
+        if (step % 97 == 0) {
+            for (const auto &[k, slot] : ref) ASSERT_EQ(idx.find(k.first, k.second), slot);
+        }
+    }
+    for (const auto &[k, slot] : ref) EXPECT_EQ(idx.find(k.first, k.second), slot);
+}
+
+TEST(DeviceIndex, ClearEmpties) {
+    Index idx;
+    idx.insert(0x1, DeviceType::COVER, 0);
+    idx.clear();
+    EXPECT_EQ(idx.size(), 0u);
+    EXPECT_EQ(idx.find(0x1, DeviceType::COVER), Index::NOT_FOUND);
+}
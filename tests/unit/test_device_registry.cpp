@@ -82,12 +82,27 @@ constexpr float DATA = 0.0f;
 namespace esphome {
 namespace elero {
 
-// Auto-complete TX — registry tests verify dispatch logic, not TX pipeline
-bool Elero::request_tx(TxClient *client, const EleroCommand &) {
-    client->on_tx_complete(true);
+// Accept every TX and never complete it — registry tests verify dispatch
+// logic, not the TX pipeline; an accepted request leaves the sender TX_PENDING.
+int g_hub_tx_requests = 0;
+
+bool Elero::request_tx(TxClient *, const EleroCommand &) {
+    ++g_hub_tx_requests;
+    return true;
+}
+
+std::vector<std::pair<const TxClient *, uint8_t>> g_hub_tx_bursts;  ///< (client, packets) of every burst
+
+bool Elero::request_tx_burst(TxClient *client, const EleroCommand &, uint8_t packets, uint8_t) {
+    ++g_hub_tx_requests;
+    g_hub_tx_bursts.emplace_back(client, packets);
     return true;
 }
 
+TxClient *g_hub_tx_aborted = nullptr;
+
+void Elero::abort_tx(TxClient *client) { g_hub_tx_aborted = client; }
+
 void Elero::setup() {}
 void Elero::loop() {}
 void Elero::dump_config() {}
@@ -112,6 +127,7 @@ namespace pkt = esphome::elero::packet;
 struct MockAdapter : public OutputAdapter {
     void setup(DeviceRegistry &) override {}
     void loop() override {}
+    AdapterInterest interest() const override { return want; }
 
     void on_device_added(const Device &dev) override {
         added.push_back(dev.config.dst_address);
@@ -123,6 +139,10 @@ struct MockAdapter : public OutputAdapter {
         state_changed.push_back(dev.config.dst_address);
         last_changes.push_back(ch);
     }
+    void on_state_batch(std::span<const StateChange> batch) override {
+        batch_sizes.push_back(batch.size());
+        OutputAdapter::on_state_batch(batch);
+    }
     void on_config_changed(const Device &dev) override {
         config_changed.push_back(dev.config.dst_address);
     }
@@ -135,11 +155,13 @@ struct MockAdapter : public OutputAdapter {
     std::vector<uint32_t> state_changed;
     std::vector<uint16_t> last_changes;
     std::vector<uint32_t> config_changed;
+    std::vector<size_t> batch_sizes;
     int rf_packets{0};
+    AdapterInterest want{};
 
     void clear() {
         added.clear(); removed.clear(); state_changed.clear();
-        last_changes.clear(); config_changed.clear(); rf_packets = 0;
+        last_changes.clear(); config_changed.clear(); batch_sizes.clear(); rf_packets = 0;
     }
 };
 
@@ -238,6 +260,25 @@ TEST_F(DeviceRegistryTest, RegisterDuplicate_UpdatesConfigInPlace) {
     EXPECT_EQ(adapter_.config_changed.size(), 1u);
 }
 
+TEST_F(DeviceRegistryTest, RegisterDuplicate_RefreshesHotConfig) {
+    auto *dev = add_cover(0xA831E5);
+    auto cfg = make_cover_config(0xA831E5);
+    cfg.open_duration_ms = 25000;
+    cfg.set_enabled(false);
+    registry_.register_device(cfg);
+
+    EXPECT_EQ(std::get<CoverDevice>(dev->logic).ctx.open_duration_ms, 25000u);
+    EXPECT_FALSE(dev->enabled);
+}
+
+TEST_F(DeviceRegistryTest, FillToCapacity_ThenNoFreeSlot) {
+    for (uint32_t i = 0; i < DeviceRegistry::MAX_DEVICES; ++i) {
+        ASSERT_NE(add_light(0x100000 + i), nullptr);
+    }
+    EXPECT_EQ(add_cover(0xA831E5), nullptr);
+    EXPECT_EQ(registry_.count_active(), DeviceRegistry::MAX_DEVICES);
+}
+
 TEST_F(DeviceRegistryTest, Remove_NotifiesBeforeDeactivation) {
     add_cover(0xA831E5);
     adapter_.clear();
@@ -255,6 +296,45 @@ TEST_F(DeviceRegistryTest, SlotExhaustion_ReturnsNull) {
     EXPECT_EQ(registry_.register_device(make_cover_config(0xFFFFFF)), nullptr);
 }
 
+TEST_F(DeviceRegistryTest, Find_TracksAddRemoveChurn) {
+    // Fill, remove every other slot, refill into the holes: the address index
+    // must stay in sync with the slots through all of it.
+    for (uint32_t i = 0; i < DeviceRegistry::MAX_DEVICES; ++i) {
+        ASSERT_NE(add_cover(0x100000 + i), nullptr);
+    }
+    for (uint32_t i = 0; i < DeviceRegistry::MAX_DEVICES; i += 2) {
+        ASSERT_TRUE(registry_.remove(0x100000 + i, DeviceType::COVER));
+    }
+    for (uint32_t i = 0; i < DeviceRegistry::MAX_DEVICES; i += 2) {
+        ASSERT_NE(add_light(0x200000 + i), nullptr);
+    }
+    for (uint32_t i = 0; i < DeviceRegistry::MAX_DEVICES; ++i) {
+        Device *cover = registry_.find(0x100000 + i, DeviceType::COVER);
+        Device *light = registry_.find(0x200000 + i, DeviceType::LIGHT);
+        if (i % 2 == 0) {
+            EXPECT_EQ(cover, nullptr);
+            ASSERT_NE(light, nullptr);
+            EXPECT_EQ(light->config.dst_address, 0x200000 + i);
+        } else {
+            ASSERT_NE(cover, nullptr);
+            EXPECT_EQ(cover->config.dst_address, 0x100000 + i);
+            EXPECT_EQ(light, nullptr);
+        }
+    }
+}
+
+TEST_F(DeviceRegistryTest, FindAnyType_ReturnsLowestSlot) {
+    // Same address as light (slot 0) and cover (slot 1)
+    Device *light = add_light(0xA831E5);
+    Device *cover = add_cover(0xA831E5);
+    ASSERT_NE(light, cover);
+    EXPECT_EQ(registry_.find(0xA831E5), light);
+    EXPECT_EQ(registry_.find(0xA831E5, DeviceType::COVER), cover);
+
+    ASSERT_TRUE(registry_.remove(0xA831E5, DeviceType::LIGHT));
+    EXPECT_EQ(registry_.find(0xA831E5), cover);
+}
+
 TEST_F(DeviceRegistryTest, RegisterDevice_RejectsWhenNvsEnabled) {
     registry_.set_nvs_enabled(true);
     EXPECT_EQ(registry_.register_device(make_cover_config(0xA831E5)), nullptr);
@@ -622,19 +702,158 @@ TEST_F(DeviceRegistryTest, Loop_LightDimComplete_EnqueuesRelease) {
     EXPECT_GE(dev->sender.queue_size(), 1u);
 }
 
+TEST_F(DeviceRegistryTest, Loop_IdleCoverWaitsForPollDeadline) {
+    mock_time_.advance(1000);
+    auto *dev = add_cover();
+    registry_.on_rf_packet(make_status_pkt(dev->config.dst_address, pkt::state::TOP),
+                           mock_time_.millis());
+    registry_.loop(mock_time_.millis());
+
+    uint32_t at = 0;
+    ASSERT_TRUE(registry_.next_deadline(at));
+    EXPECT_EQ(at, 1000u + pkt::timing::DEFAULT_POLL_INTERVAL_MS);
+
+    auto &cover = std::get<CoverDevice>(dev->logic);
+    mock_time_.current_time = at - 1;
+    registry_.loop(mock_time_.millis());
+    EXPECT_EQ(cover.poll.last_poll_ms, 1000u);
+
+    mock_time_.current_time = at;
+    registry_.loop(mock_time_.millis());
+    EXPECT_EQ(cover.poll.last_poll_ms, at);  // CHECK sent on time
+}
+
+TEST_F(DeviceRegistryTest, Loop_IdleLightUnscheduledUntilCommand) {
+    auto *dev = add_light();
+    registry_.loop(mock_time_.millis());
+
+    uint32_t at = 0;
+    EXPECT_FALSE(registry_.next_deadline(at));
+
+    mock_time_.advance(500);
+    registry_.command_light(*dev, pkt::command::UP);
+    ASSERT_TRUE(registry_.next_deadline(at));
+    EXPECT_EQ(at, mock_time_.millis());
+}
+
+TEST_F(DeviceRegistryTest, Loop_RemovedDeviceUnscheduled) {
+    add_cover(0xA831E5);
+    EXPECT_TRUE(registry_.remove(0xA831E5, DeviceType::COVER));
+
+    uint32_t at = 0;
+    EXPECT_FALSE(registry_.next_deadline(at));
+}
+
 // ═══════════════════════════════════════════════════════════════════════════════
-// POLL STAGGER — prevents RF collision when multiple blinds poll simultaneously
+// POLL SCHEDULER — prevents RF collision when multiple blinds poll simultaneously
 // ═══════════════════════════════════════════════════════════════════════════════
 
-TEST_F(DeviceRegistryTest, PollStagger_AssignsIncreasingOffsets) {
+TEST_F(DeviceRegistryTest, PollScheduler_SpacesFirstPolls) {
+    mock_time_.advance(1000);
     auto *dev1 = add_cover(0x111111);
     auto *dev2 = add_cover(0x222222);
-
     auto &c1 = std::get<CoverDevice>(dev1->logic);
     auto &c2 = std::get<CoverDevice>(dev2->logic);
+    const uint32_t gap = registry_.poll_scheduler().gap_ms();
+
+    registry_.loop(mock_time_.millis());
+    EXPECT_EQ(c1.poll.last_poll_ms, 1000u);
+    EXPECT_EQ(c2.poll.last_poll_ms, 0u);  // Both due, one CHECK per gap
+
+    uint32_t at = 0;
+    ASSERT_TRUE(registry_.next_deadline(at));
+    EXPECT_LE(at, 1000u + gap);
+
+    mock_time_.current_time = 1000 + gap;
+    registry_.loop(mock_time_.millis());
+    EXPECT_EQ(c2.poll.last_poll_ms, 1000u + gap);
+    EXPECT_EQ(registry_.poll_scheduler().polls_total(), 2u);
+}
 
-    EXPECT_EQ(c1.poll.offset_ms, 0u);
-    EXPECT_EQ(c2.poll.offset_ms, pkt::timing::POLL_OFFSET_SPACING);
+TEST_F(DeviceRegistryTest, PollScheduler_CountsUnansweredCheck) {
+    mock_time_.advance(1000);
+    auto *dev = add_cover();
+    registry_.loop(mock_time_.millis());
+    ASSERT_EQ(registry_.poll_scheduler().polls_total(), 1u);
+
+    mock_time_.advance(pkt::timing::RESPONSE_WAIT_MS);
+    registry_.loop(mock_time_.millis());
+    EXPECT_EQ(registry_.poll_scheduler().missed_total(), 1u);
+
+    // An answered CHECK is not a miss
+    mock_time_.advance(pkt::timing::DEFAULT_POLL_INTERVAL_MS);
+    registry_.loop(mock_time_.millis());
+    registry_.on_rf_packet(make_status_pkt(dev->config.dst_address, pkt::state::TOP), mock_time_.millis());
+    mock_time_.advance(pkt::timing::RESPONSE_WAIT_MS);
+    registry_.loop(mock_time_.millis());
+    EXPECT_EQ(registry_.poll_scheduler().polls_total(), 2u);
+    EXPECT_EQ(registry_.poll_scheduler().missed_total(), 1u);
+}
+
+TEST_F(DeviceRegistryTest, PassiveStatus_ReplacesRoutinePoll) {
+    mock_time_.advance(1000);
+    auto *dev = add_cover();
+    auto &cover = std::get<CoverDevice>(dev->logic);
+    registry_.loop(mock_time_.millis());
+    registry_.on_rf_packet(make_status_pkt(dev->config.dst_address, pkt::state::TOP), mock_time_.millis());
+    ASSERT_EQ(registry_.poll_scheduler().polls_total(), 1u);
+    EXPECT_EQ(registry_.poll_scheduler().passive_total(), 0u);  // Answer to our CHECK
+
+    // Blind answers a physical remote shortly before our poll would be due
+    mock_time_.advance(pkt::timing::DEFAULT_POLL_INTERVAL_MS - 1000);
+    registry_.on_rf_packet(make_status_pkt(dev->config.dst_address, pkt::state::BOTTOM), mock_time_.millis());
+    EXPECT_EQ(registry_.poll_scheduler().passive_total(), 1u);
+
+    mock_time_.advance(1000);
+    registry_.loop(mock_time_.millis());
+    EXPECT_EQ(registry_.poll_scheduler().polls_total(), 1u);
+    uint32_t at = 0;
+    ASSERT_TRUE(cover.poll.next_due(false, at));
+    EXPECT_EQ(at, mock_time_.millis() - 1000 + pkt::timing::DEFAULT_POLL_INTERVAL_MS);
+}
+
+TEST_F(DeviceRegistryTest, RemoteCommand_SchedulesOneFollowupCheck) {
+    mock_time_.advance(1000);
+    auto *dev = add_cover();
+    registry_.loop(mock_time_.millis());
+    registry_.on_rf_packet(make_status_pkt(dev->config.dst_address, pkt::state::TOP), mock_time_.millis());
+
+    mock_time_.advance(10000);
+    registry_.on_rf_packet(make_command_pkt(0xBBBBBB, dev->config.dst_address, pkt::command::STOP),
+                           mock_time_.millis());
+    uint32_t at = 0;
+    ASSERT_TRUE(registry_.next_deadline(at));
+    EXPECT_LE(at, mock_time_.millis());  // Woken to arm the follow-up
+
+    registry_.loop(mock_time_.millis());
+    EXPECT_EQ(registry_.poll_scheduler().polls_total(), 1u);  // Waits for the overheard reply
+
+    mock_time_.advance(pkt::timing::RESPONSE_WAIT_MS);
+    registry_.loop(mock_time_.millis());
+    EXPECT_EQ(registry_.poll_scheduler().polls_total(), 2u);
+
+    registry_.on_rf_packet(make_status_pkt(dev->config.dst_address, pkt::state::STOPPED), mock_time_.millis());
+    mock_time_.advance(pkt::timing::RESPONSE_WAIT_MS);
+    registry_.loop(mock_time_.millis());
+    EXPECT_EQ(registry_.poll_scheduler().polls_total(), 2u);  // One CHECK, not a series
+}
+
+TEST_F(DeviceRegistryTest, RemoteCommand_OverheardReplySkipsCheck) {
+    mock_time_.advance(1000);
+    auto *dev = add_cover();
+    registry_.loop(mock_time_.millis());
+    registry_.on_rf_packet(make_status_pkt(dev->config.dst_address, pkt::state::TOP), mock_time_.millis());
+
+    mock_time_.advance(10000);
+    registry_.on_rf_packet(make_command_pkt(0xBBBBBB, dev->config.dst_address, pkt::command::STOP),
+                           mock_time_.millis());
+    mock_time_.advance(100);
+    registry_.on_rf_packet(make_status_pkt(dev->config.dst_address, pkt::state::STOPPED), mock_time_.millis());
+
+    mock_time_.advance(pkt::timing::RESPONSE_WAIT_MS);
+    registry_.loop(mock_time_.millis());
+    EXPECT_EQ(registry_.poll_scheduler().polls_total(), 1u);
+    EXPECT_EQ(registry_.poll_scheduler().passive_total(), 1u);
 }
 
 // ═══════════════════════════════════════════════════════════════════════════════
@@ -986,3 +1205,488 @@ TEST_F(DeviceRegistryTest, CommandGroup_TracksCommandSource) {
     EXPECT_EQ(cover1.last_command_source, CommandSource::REMOTE);
     EXPECT_EQ(cover2.last_command_source, CommandSource::REMOTE);
 }
+
+// ═══════════════════════════════════════════════════════════════════════════════
+// Command coalescing — simultaneous command_cover() calls become group packets
+// ═══════════════════════════════════════════════════════════════════════════════
+
+TEST_F(DeviceRegistryTest, Coalesce_SameCommandBecomesOneGroupPacket) {
+    auto *dev1 = registry_.register_device(make_cover_config_ch(0xA00001, 1));
+    auto *dev2 = registry_.register_device(make_cover_config_ch(0xA00002, 2));
+    auto *dev3 = registry_.register_device(make_cover_config_ch(0xA00003, 5));
+    for (auto *dev : {dev1, dev2, dev3}) registry_.command_cover(*dev, pkt::command::DOWN);
+
+    // FSMs move at once; TX waits for the window
+    EXPECT_TRUE(std::holds_alternative<cover_sm::Closing>(std::get<CoverDevice>(dev3->logic).state));
+    registry_.loop(mock_time_.millis());
+    EXPECT_EQ(dev1->sender.state(), CommandSender::State::WAIT_DELAY);
+    uint32_t at = 0;
+    ASSERT_TRUE(registry_.next_deadline(at));
+    EXPECT_EQ(at, mock_time_.millis() + pkt::timing::COALESCE_WINDOW_MS);
+
+    mock_time_.advance(pkt::timing::COALESCE_WINDOW_MS);
+    registry_.loop(mock_time_.millis());
+    const auto &cmd = dev1->sender.command();
+    EXPECT_EQ(cmd.num_dests, 3);
+    EXPECT_EQ(cmd.dest_channels[0], 1);
+    EXPECT_EQ(cmd.dest_channels[1], 2);
+    EXPECT_EQ(cmd.dest_channels[2], 5);
+    EXPECT_EQ(dev1->sender.queue_size(), 2u);  // Group press + own CHECK
+    EXPECT_EQ(dev2->sender.queue_size(), 1u);  // CHECK only
+    EXPECT_EQ(dev3->sender.queue_size(), 1u);
+}
+
+TEST_F(DeviceRegistryTest, Coalesce_GroupPressIgnoresLeadLinkQuality) {
+    auto *dev1 = registry_.register_device(make_cover_config_ch(0xA00001, 1));
+    auto *dev2 = registry_.register_device(make_cover_config_ch(0xA00002, 2));
+    for (int i = 0; i < link_q::MIN_SAMPLES; ++i) {
+        registry_.on_rf_packet(make_status_pkt(0xA00001, pkt::state::TOP, -50.0f), mock_time_.millis());
+    }
+    ASSERT_EQ(dev1->sender.link().params().repeats, link_q::MIN_REPEATS);
+
+    g_hub_tx_bursts.clear();
+    for (auto *dev : {dev1, dev2}) registry_.command_cover(*dev, pkt::command::DOWN);
+    mock_time_.advance(pkt::timing::COALESCE_WINDOW_MS);
+    registry_.loop(mock_time_.millis());
+    ASSERT_EQ(dev1->sender.command().num_dests, 2);
+    mock_time_.advance(pkt::button::INTER_PACKET_MS);
+    registry_.loop(mock_time_.millis());
+
+    // dev2's link is unknown: the group press goes out with the default repeats
+    ASSERT_EQ(dev1->sender.state(), CommandSender::State::TX_PENDING);
+    auto press = std::find_if(g_hub_tx_bursts.begin(), g_hub_tx_bursts.end(),
+                              [&](const auto &b) { return b.first == &dev1->sender; });
+    ASSERT_NE(press, g_hub_tx_bursts.end());
+    EXPECT_EQ(press->second, pkt::button::PACKETS);
+}
+
+TEST_F(DeviceRegistryTest, Coalesce_DifferentCommandOrRemoteNotMerged) {
+    auto *dev1 = registry_.register_device(make_cover_config_ch(0xA00001, 1));
+    auto *dev2 = registry_.register_device(make_cover_config_ch(0xA00002, 2));
+    auto *dev3 = registry_.register_device(make_cover_config_ch(0xA00003, 3, 0xF0D009));
+    registry_.command_cover(*dev1, pkt::command::DOWN);
+    registry_.command_cover(*dev2, pkt::command::UP);
+    registry_.command_cover(*dev3, pkt::command::DOWN);
+
+    mock_time_.advance(pkt::timing::COALESCE_WINDOW_MS);
+    registry_.loop(mock_time_.millis());
+    for (auto *dev : {dev1, dev2, dev3}) {
+        EXPECT_EQ(dev->sender.command().num_dests, 0);
+        EXPECT_EQ(dev->sender.queue_size(), 2u);
+    }
+}
+
+TEST_F(DeviceRegistryTest, Coalesce_StopIsNotDelayed) {
+    mock_time_.advance(1000);
+    auto *dev1 = registry_.register_device(make_cover_config_ch(0xA00001, 1));
+    auto *dev2 = registry_.register_device(make_cover_config_ch(0xA00002, 2));
+    registry_.command_cover(*dev1, pkt::command::UP);
+    registry_.command_cover(*dev2, pkt::command::UP);
+    registry_.command_cover(*dev1, pkt::command::STOP);
+
+    registry_.loop(mock_time_.millis());
+    EXPECT_EQ(dev1->sender.state(), CommandSender::State::TX_PENDING);  // STOP on air now
+    EXPECT_EQ(dev2->sender.state(), CommandSender::State::WAIT_DELAY);  // Still held
+
+    mock_time_.advance(pkt::timing::COALESCE_WINDOW_MS);
+    registry_.loop(mock_time_.millis());
+    EXPECT_EQ(dev2->sender.command().num_dests, 0);  // Alone in its group
+    EXPECT_EQ(dev2->sender.state(), CommandSender::State::TX_PENDING);
+}
+
+TEST_F(DeviceRegistryTest, Coalesce_ZeroWindowSendsImmediately) {
+    mock_time_.advance(1000);
+    registry_.set_coalesce_window(0);
+    auto *dev1 = registry_.register_device(make_cover_config_ch(0xA00001, 1));
+    auto *dev2 = registry_.register_device(make_cover_config_ch(0xA00002, 2));
+    registry_.command_cover(*dev1, pkt::command::DOWN);
+    registry_.command_cover(*dev2, pkt::command::DOWN);
+
+    registry_.loop(mock_time_.millis());
+    EXPECT_EQ(dev1->sender.state(), CommandSender::State::TX_PENDING);
+    EXPECT_EQ(dev2->sender.state(), CommandSender::State::TX_PENDING);
+    EXPECT_EQ(dev1->sender.command().num_dests, 0);
+}
+
+// ═══════════════════════════════════════════════════════════════════════════════
+// apply_scene() — bulk moves planned together
+// ═══════════════════════════════════════════════════════════════════════════════
+
+TEST_F(DeviceRegistryTest, Scene_EndpointMovesShareOneGroupPress) {
+    auto *dev1 = registry_.register_device(make_cover_config_ch(0xA00001, 1));
+    auto *dev2 = registry_.register_device(make_cover_config_ch(0xA00002, 2));
+    auto *dev3 = registry_.register_device(make_cover_config_ch(0xA00003, 3));
+    const SceneEntry scene[] = {{dev1, 1.0f}, {dev2, 1.0f}, {dev3, cover_sm::NO_TARGET, pkt::command::UP}};
+
+    auto result = registry_.apply_scene(scene);
+    EXPECT_EQ(result.applied, 3u);
+    EXPECT_EQ(result.packets, 1u);
+    EXPECT_EQ(result.completion_ms, 5000u);  // Boot position 0.5 → open at open_duration_ms
+    EXPECT_EQ(dev1->sender.command().num_dests, 3);
+    EXPECT_EQ(dev1->sender.queue_size(), 1u);  // Press only — CHECKs come from the scheduler
+    EXPECT_EQ(dev2->sender.queue_size(), 0u);
+    EXPECT_EQ(registry_.poll_scheduler().pending_count(), 3u);
+    for (auto *dev : {dev1, dev2, dev3}) {
+        EXPECT_TRUE(std::holds_alternative<cover_sm::Opening>(std::get<CoverDevice>(dev->logic).state));
+    }
+}
+
+TEST_F(DeviceRegistryTest, Scene_IntermediateTargetsLongestTravelLeads) {
+    auto *dev1 = registry_.register_device(make_cover_config_ch(0xA00001, 1));
+    auto *dev2 = registry_.register_device(make_cover_config_ch(0xA00002, 2));
+    registry_.on_rf_packet(make_status_pkt(0xA00001, pkt::state::BOTTOM), mock_time_.millis());
+    registry_.on_rf_packet(make_status_pkt(0xA00002, pkt::state::BOTTOM), mock_time_.millis());
+    const SceneEntry scene[] = {{dev1, 0.3f}, {dev2, 0.8f}};
+
+    auto result = registry_.apply_scene(scene);
+    EXPECT_EQ(result.packets, 1u);
+    EXPECT_EQ(result.completion_ms, 8000u);
+    // dev2 travels furthest, so it carries the group press
+    EXPECT_EQ(dev2->sender.command().num_dests, 2);
+    EXPECT_EQ(dev2->sender.command().dest_channels[0], 2);
+    EXPECT_FLOAT_EQ(std::get<CoverDevice>(dev1->logic).target_position, 0.3f);
+    EXPECT_FLOAT_EQ(std::get<CoverDevice>(dev2->logic).target_position, 0.8f);
+}
+
+TEST_F(DeviceRegistryTest, Scene_MixedCommandsAndInvalidEntries) {
+    auto *up = registry_.register_device(make_cover_config_ch(0xA00001, 1));
+    auto *down = registry_.register_device(make_cover_config_ch(0xA00002, 2));
+    auto *stop = registry_.register_device(make_cover_config_ch(0xA00003, 3));
+    auto *other_remote = registry_.register_device(make_cover_config_ch(0xA00004, 4, 0xF0D009));
+    auto *light = add_light();
+    const SceneEntry scene[] = {
+        {up, 1.0f}, {down, 0.0f}, {stop, cover_sm::NO_TARGET, pkt::command::STOP},
+        {other_remote, 1.0f}, {light, 1.0f}, {nullptr, 1.0f}, {up, 2.0f},
+    };
+
+    auto result = registry_.apply_scene(scene);
+    EXPECT_EQ(result.applied, 4u);
+    EXPECT_EQ(result.skipped, 3u);  // Light, null, out-of-range position
+    EXPECT_EQ(result.packets, 3u);  // UP, DOWN, UP on a second remote — no common group
+    EXPECT_EQ(stop->sender.queue_size(), 2u);  // STOP + CHECK, sent as a single command
+    EXPECT_EQ(up->sender.command().num_dests, 0);
+}
+
+TEST_F(DeviceRegistryTest, Scene_LaterEntryForSameCoverWins) {
+    auto *dev = registry_.register_device(make_cover_config_ch(0xA00001, 1));
+    const SceneEntry scene[] = {{dev, 1.0f}, {dev, 0.0f}};
+
+    auto result = registry_.apply_scene(scene);
+    EXPECT_EQ(result.applied, 1u);
+    EXPECT_EQ(result.packets, 1u);
+    EXPECT_TRUE(std::holds_alternative<cover_sm::Closing>(std::get<CoverDevice>(dev->logic).state));
+}
+
+// ═══════════════════════════════════════════════════════════════════════════════
+// Batched notification — one update per device per loop iteration
+// ═══════════════════════════════════════════════════════════════════════════════
+
+TEST_F(DeviceRegistryTest, Batch_StatusesInOneIterationNotifyOnce) {
+    registry_.register_device(make_cover_config(0xA831E5));
+    adapter_.clear();
+
+    registry_.begin_batch();
+    registry_.on_rf_packet(make_status_pkt(0xA831E5, pkt::state::MOVING_UP, -60.0f), mock_time_.millis());
+    registry_.on_rf_packet(make_status_pkt(0xA831E5, pkt::state::TOP, -40.0f), mock_time_.millis());
+    EXPECT_TRUE(adapter_.state_changed.empty());  // Deferred until loop() ends
+
+    registry_.loop(mock_time_.millis());
+    ASSERT_EQ(adapter_.state_changed.size(), 1u);
+    EXPECT_TRUE(adapter_.last_changes[0] & state_change::POSITION);
+    EXPECT_TRUE(adapter_.last_changes[0] & state_change::RSSI);
+}
+
+TEST_F(DeviceRegistryTest, Batch_ManyDevicesDeliveredInOneCall) {
+    for (uint32_t addr : {0xA00003u, 0xA00001u, 0xA00002u}) {
+        registry_.register_device(make_cover_config_ch(addr, static_cast<uint8_t>(addr & 0xF)));
+    }
+    adapter_.clear();
+
+    registry_.begin_batch();
+    for (uint32_t addr : {0xA00002u, 0xA00003u, 0xA00001u}) {
+        registry_.on_rf_packet(make_status_pkt(addr, pkt::state::TOP), mock_time_.millis());
+    }
+    registry_.loop(mock_time_.millis());
+
+    ASSERT_EQ(adapter_.batch_sizes.size(), 1u);
+    EXPECT_EQ(adapter_.batch_sizes[0], 3u);
+    // Slot (registration) order, not arrival order
+    EXPECT_EQ(adapter_.state_changed, (std::vector<uint32_t>{0xA00003, 0xA00001, 0xA00002}));
+}
+
+TEST_F(DeviceRegistryTest, Batch_RemovedBeforeFlushIsDropped) {
+    registry_.register_device(make_cover_config(0xA831E5));
+    adapter_.clear();
+
+    registry_.begin_batch();
+    registry_.on_rf_packet(make_status_pkt(0xA831E5, pkt::state::TOP), mock_time_.millis());
+    registry_.remove(0xA831E5, DeviceType::COVER);
+    registry_.loop(mock_time_.millis());
+
+    EXPECT_TRUE(adapter_.state_changed.empty());
+    EXPECT_TRUE(adapter_.batch_sizes.empty());
+}
+
+TEST_F(DeviceRegistryTest, Batch_CommandsOutsideLoopNotifyImmediately) {
+    auto *dev = registry_.register_device(make_cover_config(0xA831E5));
+    adapter_.clear();
+
+    registry_.command_cover(*dev, pkt::command::UP);
+    EXPECT_EQ(adapter_.state_changed.size(), 1u);
+    EXPECT_TRUE(adapter_.batch_sizes.empty());
+}
+
+// ═══════════════════════════════════════════════════════════════════════════════
+// Adapter interest — events an adapter does not consume are never delivered
+// ═══════════════════════════════════════════════════════════════════════════════
+
+TEST_F(DeviceRegistryTest, Interest_RfPacketsOnlyToSubscribers) {
+    adapter_.want.rf_packets = false;
+    registry_.refresh_interest(&adapter_);
+
+    registry_.on_rf_packet(make_status_pkt(0xA831E5, pkt::state::TOP), mock_time_.millis());
+    EXPECT_EQ(adapter_.rf_packets, 0);
+
+    adapter_.want.rf_packets = true;
+    registry_.refresh_interest(&adapter_);
+    registry_.on_rf_packet(make_status_pkt(0xA831E5, pkt::state::TOP), mock_time_.millis());
+    EXPECT_EQ(adapter_.rf_packets, 1);
+}
+
+TEST_F(DeviceRegistryTest, Interest_ChangeMaskFiltersStateEvents) {
+    registry_.register_device(make_cover_config(0xA831E5));
+    registry_.on_rf_packet(make_status_pkt(0xA831E5, pkt::state::TOP, -50.0f), mock_time_.millis());
+    adapter_.want.changes = state_change::RSSI;
+    registry_.refresh_interest(&adapter_);
+    adapter_.clear();
+
+    // Same state, new RSSI → delivered
+    registry_.on_rf_packet(make_status_pkt(0xA831E5, pkt::state::TOP, -70.0f), mock_time_.millis());
+    ASSERT_EQ(adapter_.state_changed.size(), 1u);
+    // Full change mask is passed through, not just the subscribed bits
+    EXPECT_EQ(adapter_.last_changes[0] & state_change::RSSI, state_change::RSSI);
+
+    // State change with the same RSSI → not delivered
+    registry_.on_rf_packet(make_status_pkt(0xA831E5, pkt::state::BOTTOM, -70.0f), mock_time_.millis());
+    EXPECT_EQ(adapter_.state_changed.size(), 1u);
+}
+
+TEST_F(DeviceRegistryTest, Interest_DeviceTypesFilterBatch) {
+    registry_.register_device(make_cover_config(0xA831E5));
+    add_light(0xC41A2B);
+    adapter_.want.device_types = AdapterInterest::type_bit(DeviceType::LIGHT);
+    registry_.refresh_interest(&adapter_);
+    adapter_.clear();
+
+    registry_.begin_batch();
+    registry_.on_rf_packet(make_status_pkt(0xA831E5, pkt::state::TOP, -70.0f), mock_time_.millis());
+    registry_.on_rf_packet(make_status_pkt(0xC41A2B, pkt::state::LIGHT_ON, -70.0f), mock_time_.millis());
+    registry_.loop(mock_time_.millis());
+
+    ASSERT_EQ(adapter_.batch_sizes.size(), 1u);
+    EXPECT_EQ(adapter_.batch_sizes[0], 1u);
+    EXPECT_EQ(adapter_.state_changed, (std::vector<uint32_t>{0xC41A2B}));
+}
+
+TEST_F(DeviceRegistryTest, Interest_NoneSkipsEverything) {
+    adapter_.want = AdapterInterest::none();
+    registry_.refresh_interest(&adapter_);
+
+    auto *dev = registry_.register_device(make_cover_config(0xA831E5));
+    registry_.command_cover(*dev, pkt::command::UP);
+    registry_.on_rf_packet(make_status_pkt(0xA831E5, pkt::state::MOVING_UP), mock_time_.millis());
+    registry_.remove(0xA831E5, DeviceType::COVER);
+
+    EXPECT_TRUE(adapter_.added.empty());
+    EXPECT_TRUE(adapter_.state_changed.empty());
+    EXPECT_TRUE(adapter_.removed.empty());
+    EXPECT_EQ(adapter_.rf_packets, 0);
+}
+
+TEST_F(DeviceRegistryTest, Snapshot_MemoizedWithinBucket) {
+    auto *dev = registry_.register_device(make_cover_config(0xA831E5));
+    uint32_t now = mock_time_.millis();
+
+    const auto &first = registry_.cover_snapshot(*dev, now);
+    EXPECT_FLOAT_EQ(first.rssi, dev->rf.last_rssi);
+    float rssi = first.rssi;
+
+    // Mutation without a notification: same bucket still serves the memo
+    dev->rf.last_rssi = rssi - 20.0f;
+    EXPECT_FLOAT_EQ(registry_.cover_snapshot(*dev, now + 1).rssi, rssi);
+    EXPECT_EQ(&registry_.cover_snapshot(*dev, now + 1), &first);
+
+    // Next bucket recomputes
+    uint32_t later = now + pkt::timing::SNAPSHOT_BUCKET_MS;
+    EXPECT_FLOAT_EQ(registry_.cover_snapshot(*dev, later).rssi, rssi - 20.0f);
+}
+
+TEST_F(DeviceRegistryTest, Snapshot_StateChangeInvalidates) {
+    auto *dev = registry_.register_device(make_cover_config(0xA831E5));
+    uint32_t now = mock_time_.millis();
+    EXPECT_STREQ(registry_.cover_snapshot(*dev, now).ha_state, "open");
+
+    registry_.on_rf_packet(make_status_pkt(0xA831E5, pkt::state::BOTTOM, -55.0f), now);
+
+    const auto &snap = registry_.cover_snapshot(*dev, now);
+    EXPECT_STREQ(snap.ha_state, "closed");
+    EXPECT_FLOAT_EQ(snap.rssi, -55.0f);
+    EXPECT_FLOAT_EQ(snap.position, 0.0f);
+}
+
+TEST_F(DeviceRegistryTest, TxSched_NewCommandWithdrawsUnsentRequest) {
+    mock_time_.advance(1000);
+    registry_.set_coalesce_window(0);
+    auto *dev1 = registry_.register_device(make_cover_config_ch(0xA00001, 1));
+    auto *dev2 = registry_.register_device(make_cover_config_ch(0xA00002, 2));
+    auto *dev3 = registry_.register_device(make_cover_config_ch(0xA00003, 3));
+    for (auto *dev : {dev1, dev2, dev3}) registry_.command_cover(*dev, pkt::command::UP);
+
+    int posted = g_hub_tx_requests;
+    registry_.loop(mock_time_.millis());
+    const auto &tx = registry_.tx_scheduler();
+    EXPECT_EQ(g_hub_tx_requests - posted, static_cast<int>(tx_sched::MAX_IN_FLIGHT));
+    EXPECT_TRUE(tx.queued(2));  // dev3's UP waits for room in the RF queue
+    EXPECT_EQ(dev3->sender.state(), CommandSender::State::TX_PENDING);
+
+    // STOP before the UP aired: the UP never goes on air
+    registry_.command_cover(*dev3, pkt::command::STOP);
+    EXPECT_FALSE(tx.queued(2));
+    EXPECT_NE(dev3->sender.state(), CommandSender::State::TX_PENDING);
+
+    mock_time_.advance(pkt::button::INTER_PACKET_MS);
+    registry_.loop(mock_time_.millis());
+    EXPECT_TRUE(tx.queued(2));
+    EXPECT_EQ(dev3->sender.command().payload[4], pkt::command::STOP);
+
+    // dev1's UP completes — the STOP takes its place
+    dev1->sender.on_tx_burst_complete({pkt::button::PACKETS, (1u << pkt::button::PACKETS) - 1});
+    posted = g_hub_tx_requests;
+    registry_.loop(mock_time_.millis());
+    EXPECT_FALSE(tx.queued(2));
+    EXPECT_TRUE(tx.in_flight(2));
+    EXPECT_EQ(tx.sent_total(TxClass::SAFETY), 1u);
+}
+
+TEST_F(DeviceRegistryTest, TxSched_NewerMoveReplacesUnsentMove) {
+    mock_time_.advance(1000);
+    registry_.set_coalesce_window(0);
+    auto *dev1 = registry_.register_device(make_cover_config_ch(0xA00001, 1));
+    auto *dev2 = registry_.register_device(make_cover_config_ch(0xA00002, 2));
+    auto *dev3 = registry_.register_device(make_cover_config_ch(0xA00003, 3));
+    for (auto *dev : {dev1, dev2, dev3}) registry_.command_cover(*dev, pkt::command::UP);
+    registry_.loop(mock_time_.millis());
+    const auto &tx = registry_.tx_scheduler();
+    ASSERT_TRUE(tx.queued(2));
+
+    // DOWN before the UP aired: the UP and its CHECK are dropped, not queued ahead
+    registry_.command_cover(*dev3, pkt::command::DOWN);
+    EXPECT_FALSE(tx.queued(2));
+    EXPECT_EQ(dev3->sender.queue_size(), 2u);
+
+    mock_time_.advance(pkt::button::INTER_PACKET_MS);
+    registry_.loop(mock_time_.millis());
+    EXPECT_TRUE(tx.queued(2));
+    EXPECT_EQ(dev3->sender.command().payload[4], pkt::command::DOWN);
+
+    // Same for a position move and a tilt
+    registry_.set_cover_position(*dev3, 1.0f);
+    EXPECT_FALSE(tx.queued(2));
+    EXPECT_EQ(dev3->sender.queue_size(), 2u);
+    registry_.command_cover_tilt(*dev3);
+    EXPECT_FALSE(tx.queued(2));
+    EXPECT_EQ(dev3->sender.queue_size(), 2u);
+
+    mock_time_.advance(pkt::button::INTER_PACKET_MS);
+    registry_.loop(mock_time_.millis());
+    EXPECT_EQ(dev3->sender.command().payload[4], pkt::command::TILT);
+}
+
+TEST_F(DeviceRegistryTest, DutyCycle_DeferredCheckDoesNotHoldBackCommands) {
+    mock_time_.advance(1000);
+    registry_.set_coalesce_window(0);
+    auto *cover = registry_.register_device(make_cover_config(0xA831E5));
+    auto *light = registry_.register_device(make_light_config(0xC41A2B));
+    const auto &tx = registry_.tx_scheduler();
+    auto cover_id = static_cast<uint8_t>(0);
+    auto light_id = static_cast<uint8_t>(1);
+
+    // Budget spent: only USER/SAFETY may go on air
+    uint32_t now = mock_time_.millis();
+    registry_.on_tx_airtime(now, registry_.duty_cycle().hour_budget_us());
+    ASSERT_EQ(registry_.duty_cycle().lowest_allowed(now), TxClass::USER);
+
+    registry_.request_check(*cover);
+    registry_.request_check(*light);
+    int posted = g_hub_tx_requests;
+    registry_.loop(now);
+    ASSERT_TRUE(tx.queued(cover_id));
+    ASSERT_TRUE(tx.queued(light_id));
+    EXPECT_EQ(g_hub_tx_requests, posted);
+
+    // The moves do not wait behind the deferred CHECKs
+    registry_.command_cover(*cover, pkt::command::UP);
+    registry_.command_light(*light, pkt::command::UP);
+    mock_time_.advance(pkt::button::INTER_PACKET_MS);
+    registry_.loop(mock_time_.millis());
+    EXPECT_EQ(g_hub_tx_requests - posted, 2);
+    EXPECT_TRUE(tx.in_flight(cover_id));
+    EXPECT_TRUE(tx.in_flight(light_id));
+    EXPECT_EQ(cover->sender.command().payload[4], pkt::command::UP);
+    EXPECT_EQ(light->sender.command().payload[4], pkt::command::UP);
+    EXPECT_EQ(tx.sent_total(TxClass::FOLLOW_UP), 0u);
+}
+
+TEST_F(DeviceRegistryTest, AckAware_MatchingStatusAbortsBurstAndDropsCheck) {
+    mock_time_.advance(1000);
+    registry_.set_coalesce_window(0);
+    auto *dev = registry_.register_device(make_cover_config(0xA831E5));
+    registry_.command_cover(*dev, pkt::command::UP);
+    registry_.loop(mock_time_.millis());
+    ASSERT_EQ(dev->sender.state(), CommandSender::State::TX_PENDING);
+
+    // STOPPED does not confirm an UP
+    g_hub_tx_aborted = nullptr;
+    registry_.on_rf_packet(make_status_pkt(0xA831E5, pkt::state::STOPPED), mock_time_.millis());
+    EXPECT_EQ(g_hub_tx_aborted, nullptr);
+
+    registry_.on_rf_packet(make_status_pkt(0xA831E5, pkt::state::MOVING_UP), mock_time_.millis());
+    EXPECT_EQ(g_hub_tx_aborted, &dev->sender);
+
+    // The RF task reports the cut-short burst: no follow-up CHECK remains
+    dev->sender.on_tx_burst_complete({1, 0b1});
+    EXPECT_FALSE(dev->sender.is_busy());
+}
+
+TEST_F(DeviceRegistryTest, Link_StatusFeedsLinkQuality) {
+    auto *dev = registry_.register_device(make_cover_config(0xA831E5));
+    for (int i = 0; i < link_q::MIN_SAMPLES; ++i) {
+        registry_.on_rf_packet(make_status_pkt(0xA831E5, pkt::state::TOP, -50.0f), mock_time_.millis());
+    }
+    const auto &link = dev->sender.link();
+    EXPECT_TRUE(link.has_rssi());
+    EXPECT_FLOAT_EQ(link.rssi(), -50.0f);
+    EXPECT_EQ(link.params().repeats, link_q::MIN_REPEATS);
+
+    registry_.set_adaptive_link(false);
+    EXPECT_EQ(link.params().repeats, pkt::button::PACKETS);
+
+    // A re-registered slot starts from a clean link, keeping the setting
+    ASSERT_TRUE(registry_.remove(0xA831E5, DeviceType::COVER));
+    dev = registry_.register_device(make_cover_config(0xA831E5));
+    EXPECT_FALSE(dev->sender.link().has_rssi());
+}
+
+TEST_F(DeviceRegistryTest, AckAware_DisabledSendsFullBurst) {
+    mock_time_.advance(1000);
+    registry_.set_coalesce_window(0);
+    registry_.set_ack_aware_repeats(false);
+    auto *dev = registry_.register_device(make_cover_config(0xA831E5));
+    registry_.command_cover(*dev, pkt::command::UP);
+    registry_.loop(mock_time_.millis());
+
+    g_hub_tx_aborted = nullptr;
+    registry_.on_rf_packet(make_status_pkt(0xA831E5, pkt::state::MOVING_UP), mock_time_.millis());
+    EXPECT_EQ(g_hub_tx_aborted, nullptr);
+    EXPECT_EQ(dev->sender.state(), CommandSender::State::TX_PENDING);
+}
@@ -0,0 +1,71 @@
+/// @file test_duty_cycle.cpp
+/// @brief Unit tests for the duty-cycle airtime accountant (duty_cycle.h).
+
+#include <gtest/gtest.h>
+
+#include "elero/duty_cycle.h"
+
+using namespace esphome::elero;
+
+static constexpr uint32_t FRAME_US = 5000;  // One Elero frame at 76.8 kBaud
+
+TEST(DutyCycle, BudgetsFollowLimit) {
+    DutyCycle d;
+    EXPECT_EQ(d.hour_budget_us(), 36000000u);  // 1% of an hour: 36 s
+    d.set_limit(0.1f);
+    EXPECT_EQ(d.hour_budget_us(), 360000000u);
+    d.set_limit(0.0f);  // invalid, ignored
+    EXPECT_FLOAT_EQ(d.limit(), 0.1f);
+}
+
+TEST(DutyCycle, WindowsSumAndExpire) {
+    DutyCycle d;
+    d.on_tx(1000, FRAME_US);
+    d.on_tx(30000, FRAME_US);
+    EXPECT_EQ(d.minute_us(30000), 2 * FRAME_US);
+    EXPECT_EQ(d.hour_us(30000), 2 * FRAME_US);
+
+    // First frame's 5 s bucket has left the minute window, both are in the hour
+    EXPECT_EQ(d.minute_us(66000), FRAME_US);
+    EXPECT_EQ(d.minute_us(91000), 0u);
+    EXPECT_EQ(d.hour_us(91000), 2 * FRAME_US);
+    EXPECT_EQ(d.hour_us(duty::HOUR_MS + 60000), 0u);
+    EXPECT_EQ(d.total_us(), 2 * FRAME_US);
+}
+
+TEST(DutyCycle, BucketReusedAfterWrapAround) {
+    DutyCycle d;
+    d.on_tx(0, FRAME_US);
+    // Same minute-window slot twelve buckets later: old airtime is dropped, not added to
+    d.on_tx(duty::MINUTE_MS, FRAME_US);
+    EXPECT_EQ(d.minute_us(duty::MINUTE_MS), FRAME_US);
+}
+
+TEST(DutyCycle, BackgroundDeferredNearLimitCommandsOnlyAtLimit) {
+    DutyCycle d;
+    uint32_t minute_budget_us = 600000;  // 1% of 60 s
+    EXPECT_EQ(d.lowest_allowed(0), TxClass::BACKGROUND);
+
+    d.on_tx(0, minute_budget_us * 8 / 10);
+    EXPECT_EQ(d.lowest_allowed(0), TxClass::FOLLOW_UP);
+
+    d.on_tx(0, minute_budget_us * 2 / 10);
+    EXPECT_EQ(d.lowest_allowed(0), TxClass::USER);
+
+    // Minute window drains; the hour window alone is far from its budget
+    EXPECT_EQ(d.lowest_allowed(duty::MINUTE_MS + 5000), TxClass::BACKGROUND);
+}
+
+TEST(DutyCycle, HourWindowLimitsSustainedTraffic) {
+    DutyCycle d;
+    // 30 s of airtime spread over 50 minutes: never more than 1.2% in a minute
+    for (uint32_t m = 0; m < 50; ++m) d.on_tx(m * 60000, 600000);
+    uint32_t now = 50 * 60000;
+    EXPECT_LT(d.minute_us(now), 600000u);
+    EXPECT_EQ(d.hour_remaining_us(now), 6000000u);
+    EXPECT_EQ(d.lowest_allowed(now), TxClass::FOLLOW_UP);  // 83% of the hour used
+
+    for (uint32_t m = 50; m < 60; ++m) d.on_tx(m * 60000, 600000);
+    EXPECT_EQ(d.hour_remaining_us(60 * 60000 - 1), 0u);
+    EXPECT_EQ(d.lowest_allowed(60 * 60000 - 1), TxClass::USER);
+}
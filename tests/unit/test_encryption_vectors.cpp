@@ -43,6 +43,19 @@ TEST(LookupTableIntegrity, EncodeTableIsBijection) {
   }
 }
 
+TEST(LookupTableIntegrity, ByteTablesMatchNibbleTables) {
+  for (int b = 0; b < 256; b++) {
+    SCOPED_TRACE("byte value: " + std::to_string(b));
+    uint8_t enc[1] = {static_cast<uint8_t>(b)};
+    uint8_t dec[1] = {static_cast<uint8_t>(b)};
+    protocol::encode_nibbles(enc, 1);
+    protocol::decode_nibbles(dec, 1);
+    EXPECT_EQ(protocol::ENCODE_BYTE_TABLE[b], enc[0]);
+    EXPECT_EQ(protocol::DECODE_BYTE_TABLE[b], dec[0]);
+    EXPECT_EQ(protocol::DECODE_BYTE_TABLE[protocol::ENCODE_BYTE_TABLE[b]], b);
+  }
+}
+
 // =============================================================================
 // KNOWN-ANSWER ENCRYPTION VECTORS
 // Generated from working implementation, locked down as regression tests.
@@ -406,6 +419,119 @@ TEST(NibbleCodec, HighAndLowNibblesProcessedIndependently) {
   EXPECT_EQ(buf_hi[0], 0x28);
 }
 
+// =============================================================================
+// FUSED CODEC ≡ MULTI-PASS REFERENCE
+// msg_encode/msg_decode run as a single table-driven pass; the step helpers
+// above remain the readable reference. Both must agree bit for bit.
+// =============================================================================
+
+static void reference_decode(uint8_t *msg) {
+  protocol::decode_nibbles(msg, 8);
+  protocol::sub_r20_from_nibbles(msg, protocol::crypto_local::R20_INITIAL, 0, 2);
+  protocol::xor_2byte_in_array_decode(msg, msg[0], msg[1]);
+  protocol::sub_r20_from_nibbles(msg, protocol::crypto_local::R20_SECOND, 2, 8);
+}
+
+static void reference_encode(uint8_t *msg) {
+  uint8_t xor0 = msg[0];
+  uint8_t xor1 = msg[1];
+  uint8_t p = 0;
+  for (uint8_t i = 0; i < 4; ++i) {
+    p |= protocol::count_bits(msg[i * 2]) ^ protocol::count_bits(msg[i * 2 + 1]);
+    p <<= 1;
+  }
+  msg[7] = (p << 3);
+  protocol::add_r20_to_nibbles(msg, protocol::crypto_local::R20_INITIAL, 0, 8);
+  protocol::xor_2byte_in_array_encode(msg, xor0, xor1);
+  protocol::encode_nibbles(msg);
+}
+
+TEST(FusedCodec, MatchesReferenceOnPseudoRandomInput) {
+  uint32_t x = 0x12345678;  // xorshift32, fixed seed
+  for (int n = 0; n < 20000; n++) {
+    uint8_t in[8];
+    for (auto &b : in) {
+      x ^= x << 13;
+      x ^= x >> 17;
+      x ^= x << 5;
+      b = static_cast<uint8_t>(x);
+    }
+    uint8_t fused[8], ref[8];
+
+    memcpy(fused, in, 8);
+    memcpy(ref, in, 8);
+    protocol::msg_encode(fused);
+    reference_encode(ref);
+    ASSERT_EQ(memcmp(fused, ref, 8), 0) << "encode mismatch at iteration " << n;
+
+    memcpy(fused, in, 8);
+    memcpy(ref, in, 8);
+    protocol::msg_decode(fused);
+    reference_decode(ref);
+    ASSERT_EQ(memcmp(fused, ref, 8), 0) << "decode mismatch at iteration " << n;
+  }
+}
+
+TEST(FusedCodec, MatchesReferenceForEveryCounterAndCommand) {
+  const uint8_t commands[] = {0x00, 0x10, 0x20, 0x24, 0x40, 0x44};
+  for (int counter = 0; counter < 256; counter++) {
+    for (uint8_t cmd : commands) {
+      uint16_t code = packet::calc_crypto_code(static_cast<uint8_t>(counter));
+      uint8_t plain[8] = {static_cast<uint8_t>(code >> 8), static_cast<uint8_t>(code), cmd, 0, 0, 0, 0, 0};
+      uint8_t fused[8], ref[8];
+      memcpy(fused, plain, 8);
+      memcpy(ref, plain, 8);
+      protocol::msg_encode(fused);
+      reference_encode(ref);
+      ASSERT_EQ(memcmp(fused, ref, 8), 0) << "counter " << counter << " cmd " << (int) cmd;
+    }
+  }
+}
+
+// =============================================================================
+// ENCRYPTED PAYLOAD CACHE
+// The compile-time table must hold exactly what msg_encode would produce.
+// =============================================================================
+
+TEST(PayloadCache, MatchesMsgEncodeForAllCountersAndCommands) {
+  for (uint8_t cmd : packet::payload_cache::COMMANDS) {
+    for (int counter = 0; counter < 256; counter++) {
+      uint16_t code = packet::calc_crypto_code(static_cast<uint8_t>(counter));
+      uint8_t expected[8] = {static_cast<uint8_t>(code >> 8), static_cast<uint8_t>(code), cmd, 0, 0, 0, 0, 0};
+      protocol::msg_encode(expected);
+
+      const uint8_t *cached = packet::payload_cache::lookup(static_cast<uint8_t>(counter), cmd);
+      ASSERT_NE(cached, nullptr);
+      ASSERT_EQ(memcmp(cached, expected, 8), 0) << "counter " << counter << " cmd " << (int) cmd;
+    }
+  }
+}
+
+TEST(PayloadCache, UncachedCommandFallsBackToEncode) {
+  EXPECT_EQ(packet::payload_cache::lookup(1, 0x55), nullptr);
+
+  uint8_t expected[8] = {0, 0, 0x55, 0, 0, 0, 0, 0};
+  uint16_t code = packet::calc_crypto_code(7);
+  expected[0] = code >> 8;
+  expected[1] = code & 0xFF;
+  protocol::msg_encode(expected);
+
+  uint8_t enc[8];
+  packet::write_encrypted_payload(enc, 7, 0x55);
+  EXPECT_EQ(memcmp(enc, expected, 8), 0);
+}
+
+TEST(PayloadCache, StatusStateBypassesCache) {
+  uint16_t code = packet::calc_crypto_code(9);
+  uint8_t expected[8] = {static_cast<uint8_t>(code >> 8), static_cast<uint8_t>(code), 0, 0, 0, 0,
+                         packet::state::TOP, 0};
+  protocol::msg_encode(expected);
+
+  uint8_t enc[8];
+  packet::write_encrypted_payload(enc, 9, 0, packet::state::TOP);
+  EXPECT_EQ(memcmp(enc, expected, 8), 0);
+}
+
 // =============================================================================
 // RSSI EDGE CASES
 // =============================================================================
@@ -0,0 +1,62 @@
+/// @file test_lbt.cpp
+/// @brief Unit tests for the RF task listen-before-talk gate (lbt.h).
+
+#include <gtest/gtest.h>
+
+#include "elero/lbt.h"
+
+using namespace esphome::elero;
+
+static constexpr int16_t QUIET = -110;
+static constexpr int16_t BUSY = -60;
+
+TEST(ListenBeforeTalk, ClearChannelSendsNow) {
+    ListenBeforeTalk g;
+    EXPECT_EQ(g.check(true, QUIET, 1000, 0), 0u);
+    EXPECT_EQ(g.clear_total(), 1u);
+    EXPECT_EQ(g.busy_total(), 0u);
+}
+
+TEST(ListenBeforeTalk, BusyChannelBacksOffWithJitter) {
+    ListenBeforeTalk g;
+    uint32_t w0 = g.check(true, BUSY, 1000, 0);
+    uint32_t w1 = g.check(true, BUSY, 1000 + w0, 5);
+    EXPECT_EQ(w0, lbt::BACKOFF_MIN_MS);
+    EXPECT_EQ(w1, lbt::BACKOFF_MIN_MS + 5 % lbt::BACKOFF_JITTER_MS);
+    EXPECT_EQ(g.busy_total(), 2u);
+}
+
+TEST(ListenBeforeTalk, ThresholdIsInclusive) {
+    ListenBeforeTalk g;
+    g.set_busy_dbm(-80);
+    EXPECT_GT(g.check(true, -80, 0, 0), 0u);
+    EXPECT_EQ(g.check(true, -81, 10, 0), 0u);
+}
+
+TEST(ListenBeforeTalk, ForcedAfterMaxDeferral) {
+    ListenBeforeTalk g;
+    uint32_t now = 1000;
+    while (uint32_t wait = g.check(true, BUSY, now, 3)) now += wait;
+    EXPECT_GE(now - 1000, lbt::MAX_DEFER_MS);
+    EXPECT_LT(now - 1000, lbt::MAX_DEFER_MS + lbt::BACKOFF_MIN_MS + lbt::BACKOFF_JITTER_MS);
+    EXPECT_EQ(g.forced_total(), 1u);
+
+    // The next packet starts a fresh deferral budget
+    EXPECT_GT(g.check(true, BUSY, now + 20, 0), 0u);
+}
+
+TEST(ListenBeforeTalk, UnsampledOrDisabledGoesUngated) {
+    ListenBeforeTalk g;
+    EXPECT_EQ(g.check(false, BUSY, 0, 0), 0u);
+    g.set_enabled(false);
+    EXPECT_EQ(g.check(true, BUSY, 10, 0), 0u);
+    EXPECT_EQ(g.clear_total() + g.busy_total() + g.forced_total(), 0u);
+}
+
+TEST(ListenBeforeTalk, DeferralAcrossMillisWrap) {
+    ListenBeforeTalk g;
+    uint32_t now = 0xFFFFFFF0u;
+    while (uint32_t wait = g.check(true, BUSY, now, 1)) now += wait;
+    EXPECT_EQ(g.forced_total(), 1u);
+    EXPECT_GE(now - 0xFFFFFFF0u, lbt::MAX_DEFER_MS);
+}
@@ -0,0 +1,93 @@
+/// @file test_link_quality.cpp
+/// @brief Unit tests for per-device link statistics and learned TX parameters.
+
+#include <gtest/gtest.h>
+
+#include "elero/link_quality.h"
+
+using namespace esphome::elero;
+namespace pkt = esphome::elero::packet;
+
+/// Feed @p n observations of a link with the given RSSI, poll answers and retries.
+static void observe(LinkQuality &lq, int n, float rssi, bool answered, uint8_t retries) {
+    for (int i = 0; i < n; ++i) {
+        lq.on_rssi(rssi);
+        if (answered) lq.on_check_answered(); else lq.on_check_missed();
+        lq.on_command_done(retries);
+    }
+}
+
+TEST(LinkQuality, DefaultsUntilLearned) {
+    LinkQuality lq;
+    EXPECT_FALSE(lq.learned());
+    EXPECT_EQ(lq.params().repeats, pkt::button::PACKETS);
+    EXPECT_EQ(lq.params().max_retries, pkt::limits::SEND_RETRIES);
+    EXPECT_EQ(lq.params().backoff_shift, 0);
+
+    // A few strong observations are not enough yet
+    for (int i = 0; i < link_q::MIN_SAMPLES - 1; ++i) lq.on_rssi(-50.0f);
+    EXPECT_FALSE(lq.learned());
+    EXPECT_EQ(lq.params().repeats, pkt::button::PACKETS);
+}
+
+TEST(LinkQuality, StrongLinkSendsFewerRepeats) {
+    LinkQuality lq;
+    observe(lq, 10, -55.0f, true, 0);
+    EXPECT_TRUE(lq.learned());
+    EXPECT_EQ(lq.params().repeats, link_q::MIN_REPEATS);
+    EXPECT_EQ(lq.params().max_retries, pkt::limits::SEND_RETRIES);
+    EXPECT_EQ(lq.params().backoff_shift, 0);
+}
+
+TEST(LinkQuality, AverageLinkKeepsDefaults) {
+    LinkQuality lq;
+    observe(lq, 10, -80.0f, true, 0);
+    EXPECT_EQ(lq.params().repeats, pkt::button::PACKETS);
+    EXPECT_EQ(lq.params().max_retries, pkt::limits::SEND_RETRIES);
+}
+
+TEST(LinkQuality, StrongRssiNeedsAnswersToo) {
+    LinkQuality lq;
+    for (int i = 0; i < 10; ++i) lq.on_rssi(-55.0f);
+    // Close, but one poll in five lost: not strong
+    for (int i = 0; i < 20; ++i) {
+        if (i % 5 == 4) lq.on_check_missed(); else lq.on_check_answered();
+    }
+    EXPECT_EQ(lq.params().repeats, pkt::button::PACKETS);
+}
+
+TEST(LinkQuality, WeakLinkGetsMoreRepeatsRetriesAndBackoff) {
+    LinkQuality lq;
+    observe(lq, 10, -95.0f, true, 0);
+    EXPECT_EQ(lq.params().repeats, pkt::button::PACKETS + 1);
+    EXPECT_EQ(lq.params().max_retries, pkt::limits::SEND_RETRIES + 1);
+    EXPECT_EQ(lq.params().backoff_shift, 1);
+}
+
+TEST(LinkQuality, ParametersStayWithinBounds) {
+    LinkQuality lq;
+    observe(lq, 50, -100.0f, false, 6);
+    EXPECT_EQ(lq.params().repeats, link_q::MAX_REPEATS);
+    EXPECT_EQ(lq.params().max_retries, link_q::MAX_RETRIES);
+    EXPECT_EQ(lq.params().backoff_shift, link_q::MAX_BACKOFF_SHIFT);
+}
+
+TEST(LinkQuality, RecoversWhenLinkImproves) {
+    LinkQuality lq;
+    observe(lq, 20, -95.0f, false, 2);
+    ASSERT_GT(lq.params().repeats, pkt::button::PACKETS);
+    observe(lq, 60, -55.0f, true, 0);
+    EXPECT_EQ(lq.params().repeats, link_q::MIN_REPEATS);
+}
+
+TEST(LinkQuality, NonAdaptiveKeepsDefaultsButTracks) {
+    LinkQuality lq;
+    lq.set_adaptive(false);
+    observe(lq, 20, -55.0f, true, 0);
+    EXPECT_EQ(lq.params().repeats, pkt::button::PACKETS);
+    EXPECT_FLOAT_EQ(lq.rssi(), -55.0f);
+    EXPECT_FLOAT_EQ(lq.response_rate(), 1.0f);
+
+    lq.set_adaptive(true);
+    EXPECT_EQ(lq.params().repeats, link_q::MIN_REPEATS);
+}
@@ -123,6 +123,32 @@ TEST(PacketParsing, InvalidPacket_TruncatedPayload) {
   EXPECT_STREQ(result.reject_reason, "truncated_payload");
 }
 
+// ============================================================================
+// Valid Packet Tests
+// ============================================================================
+
+TEST(PacketParsing, AllVectors_MatchExpectations) {
+  for (const auto *vec : ALL_VECTORS) {
+    SCOPED_TRACE(vec->name);
+    auto result = parse_packet(vec->raw, vec->raw_len);
+    ASSERT_EQ(result.valid, vec->expect_valid);
+    if (!vec->expect_valid) {
+      EXPECT_STREQ(result.reject_reason, vec->reject_reason);
+      continue;
+    }
+    EXPECT_EQ(result.type, vec->exp_type);
+    EXPECT_EQ(result.channel, vec->exp_channel);
+    EXPECT_EQ(result.src_addr, vec->exp_src_addr);
+    EXPECT_EQ(result.dst_addr, vec->exp_dst_addr);
+    EXPECT_EQ(result.crc_ok, 1);
+    if (is_status_packet(result.type)) {
+      EXPECT_EQ(result.state, vec->exp_state);
+    } else {
+      EXPECT_EQ(result.payload[payload_offset::COMMAND], vec->exp_command);
+    }
+  }
+}
+
 // ============================================================================
 // Payload Encoding/Decoding Tests
 // ============================================================================
@@ -0,0 +1,157 @@
+/// @file test_poll_scheduler.cpp
+/// @brief Unit tests for the hub-wide poll scheduler (airtime budget, priority, backoff).
+
+#include <gtest/gtest.h>
+
+#include "elero/poll_scheduler.h"
+#include "elero/radio_driver.h"
+#include "elero/elero_packet.h"
+
+using namespace esphome::elero;
+
+using Sched = PollScheduler<48>;
+
+TEST(PollScheduler, ExchangeAirtimeMatchesCc1101Framing) {
+    // (18 overhead + 30 frame) bytes × 8 bits / 76.8 kBaud = 5 ms per frame
+    EXPECT_EQ(frame_airtime_us(packet::TX_MSG_LENGTH + 1, 76800), 5000u);
+    EXPECT_EQ(poll_sched::DEFAULT_EXCHANGE_AIRTIME_MS, 10u);
+}
+
+TEST(PollScheduler, ExchangeAirtimeSetByHubScalesGap) {
+    Sched s;
+    EXPECT_EQ(s.exchange_airtime_ms(), poll_sched::DEFAULT_EXCHANGE_AIRTIME_MS);
+    s.set_exchange_airtime_ms(20);  // e.g. a slower radio
+    EXPECT_EQ(s.gap_ms(), 200u);
+    s.set_exchange_airtime_ms(0);   // invalid, ignored
+    EXPECT_EQ(s.exchange_airtime_ms(), 20u);
+}
+
+TEST(PollScheduler, GapFollowsBudget) {
+    Sched s;
+    EXPECT_EQ(s.gap_ms(), 100u);  // 10 ms exchange at 10%
+    s.set_budget(0.5f);
+    EXPECT_EQ(s.gap_ms(), 20u);
+    s.set_budget(0.0f);  // invalid, ignored
+    EXPECT_EQ(s.gap_ms(), 20u);
+}
+
+TEST(PollScheduler, OneGrantPerGap) {
+    Sched s;
+    for (uint8_t id = 0; id < 5; ++id) s.request(id, PollPriority::ROUTINE, 0);
+
+    uint8_t id = 0;
+    uint32_t now = 1000;
+    ASSERT_TRUE(s.take(now, id));
+    s.on_granted(now);
+    EXPECT_FALSE(s.take(now + s.gap_ms() - 1, id));
+    EXPECT_EQ(s.next_grant_ms(), now + s.gap_ms());
+    EXPECT_TRUE(s.take(now + s.gap_ms(), id));
+    EXPECT_EQ(s.pending_count(), 3u);
+}
+
+TEST(PollScheduler, MovingBeforeRecentBeforeRoutineThenOldest) {
+    Sched s;
+    s.request(1, PollPriority::ROUTINE, 100);
+    s.request(2, PollPriority::RECENT_COMMAND, 300);
+    s.request(3, PollPriority::ROUTINE, 50);
+    s.request(4, PollPriority::MOVING, 400);
+    s.request(5, PollPriority::RECENT_COMMAND, 200);
+
+    uint8_t order[5];
+    uint32_t now = 1000;
+    for (auto &o : order) {
+        ASSERT_TRUE(s.take(now, o));
+        s.on_granted(now);
+        now += s.gap_ms();
+    }
+    EXPECT_EQ(order[0], 4);
+    EXPECT_EQ(order[1], 5);
+    EXPECT_EQ(order[2], 2);
+    EXPECT_EQ(order[3], 3);
+    EXPECT_EQ(order[4], 1);
+}
+
+TEST(PollScheduler, LowestPriorityKeepsRoutineRequestsPending) {
+    Sched s;
+    s.request(1, PollPriority::ROUTINE, 0);
+    uint8_t id = 0;
+    EXPECT_FALSE(s.take(1000, id, nullptr, PollPriority::RECENT_COMMAND));
+    EXPECT_TRUE(s.pending(1));
+    s.request(2, PollPriority::MOVING, 10);
+    ASSERT_TRUE(s.take(1000, id, nullptr, PollPriority::RECENT_COMMAND));
+    EXPECT_EQ(id, 2);
+}
+
+TEST(PollScheduler, RequestOnlyUpgradesPriority) {
+    Sched s;
+    s.request(7, PollPriority::ROUTINE, 0);
+    s.request(8, PollPriority::RECENT_COMMAND, 10);
+    s.request(7, PollPriority::MOVING, 20);
+    s.request(8, PollPriority::ROUTINE, 30);  // no downgrade
+    EXPECT_EQ(s.pending_count(), 2u);
+
+    uint8_t id = 0;
+    ASSERT_TRUE(s.take(0, id));
+    EXPECT_EQ(id, 7);
+}
+
+TEST(PollScheduler, CancelDropsRequest) {
+    Sched s;
+    s.request(3, PollPriority::ROUTINE, 0);
+    s.cancel(3);
+    s.cancel(3);
+    EXPECT_FALSE(s.pending(3));
+    uint8_t id = 0;
+    EXPECT_FALSE(s.take(0, id));
+}
+
+TEST(PollScheduler, BusyChannelWidensGapQuietChannelRestoresIt) {
+    Sched s;
+    uint32_t now = 0;
+    s.update(now);
+    const uint32_t base = s.gap_ms();
+
+    // 50% occupancy for one window → back off one step
+    for (int i = 0; i < 100; ++i) {
+        now += 100;
+        s.on_air(now, 50);
+    }
+    s.update(now);
+    EXPECT_GT(s.occupancy(), poll_sched::BUSY_OCCUPANCY);
+    EXPECT_EQ(s.gap_ms(), base * 2);
+
+    // Silence → recover
+    now += poll_sched::OCCUPANCY_WINDOW_MS;
+    s.update(now);
+    EXPECT_EQ(s.gap_ms(), base);
+    EXPECT_EQ(s.backoff_shift(), 0u);
+}
+
+TEST(PollScheduler, BackoffIsBounded) {
+    Sched s;
+    uint32_t now = 0;
+    s.update(now);
+    for (int w = 0; w < 10; ++w) {
+        now += poll_sched::OCCUPANCY_WINDOW_MS;
+        s.on_air(now, poll_sched::OCCUPANCY_WINDOW_MS);
+    }
+    EXPECT_EQ(s.backoff_shift(), poll_sched::MAX_BACKOFF_SHIFT);
+}
+
+TEST(PollScheduler, ReportsPollRateAndMisses) {
+    Sched s;
+    uint32_t now = 0;
+    s.update(now);
+    for (int i = 0; i < 30; ++i) {
+        s.request(0, PollPriority::ROUTINE, now);
+        uint8_t id = 0;
+        ASSERT_TRUE(s.take(now, id));
+        s.on_granted(now);
+        now += 2000;
+    }
+    s.on_missed();
+    s.update(poll_sched::RATE_WINDOW_MS);
+    EXPECT_EQ(s.polls_total(), 30u);
+    EXPECT_EQ(s.missed_total(), 1u);
+    EXPECT_FLOAT_EQ(s.polls_per_minute(), 30.0f);
+}
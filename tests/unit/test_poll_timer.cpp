@@ -275,6 +275,45 @@ TEST_F(PollTimerTest, CommandThenRfThenIntervalCycle) {
     EXPECT_TRUE(fast_timer.should_poll(12201, false));
 }
 
+// =============================================================================
+// 13. OBSERVED REMOTE COMMAND -> ONE FOLLOW-UP CHECK
+// =============================================================================
+
+TEST_F(PollTimerTest, RemoteCommandDueAfterResponseWait) {
+    fast_timer.on_rf_received(1000);
+    fast_timer.on_remote_command(2000);
+
+    EXPECT_FALSE(fast_timer.should_poll(2000 + timing::RESPONSE_WAIT_MS - 1, false));
+    EXPECT_TRUE(fast_timer.should_poll(2000 + timing::RESPONSE_WAIT_MS, false));
+
+    uint32_t at = 0;
+    ASSERT_TRUE(fast_timer.next_due(false, at));
+    EXPECT_EQ(at, 2000 + timing::RESPONSE_WAIT_MS);
+}
+
+TEST_F(PollTimerTest, OverheardStatusCancelsFollowup) {
+    fast_timer.on_rf_received(1000);
+    fast_timer.on_remote_command(2000);
+    fast_timer.on_rf_received(2100);  // Blind answered the remote
+
+    EXPECT_FALSE(fast_timer.followup_pending);
+    EXPECT_FALSE(fast_timer.should_poll(2000 + timing::RESPONSE_WAIT_MS, false));
+    EXPECT_TRUE(fast_timer.should_poll(7100, false));
+}
+
+TEST_F(PollTimerTest, FollowupClearedByPoll) {
+    fast_timer.on_rf_received(1000);
+    fast_timer.on_remote_command(2000);
+    fast_timer.on_poll_sent(2000 + timing::RESPONSE_WAIT_MS);
+    EXPECT_FALSE(fast_timer.followup_pending);
+}
+
+TEST_F(PollTimerTest, RemoteCommandIgnoredWhileAwaitingOwnResponse) {
+    fast_timer.on_command_sent(1000);
+    fast_timer.on_remote_command(1100);
+    EXPECT_FALSE(fast_timer.followup_pending);
+}
+
 // =============================================================================
 // EDGE CASES
 // =============================================================================
@@ -0,0 +1,86 @@
+/// @file test_rf_task_timing.cpp
+/// @brief Unit tests for the event-driven RF task sleep schedule and load meter.
+
+#include <gtest/gtest.h>
+
+#include "elero/elero_packet.h"
+#include "elero/rf_task_timing.h"
+
+using namespace esphome::elero;
+
+// =============================================================================
+// 1. SLEEP SCHEDULE
+// =============================================================================
+
+TEST(RfTaskSleep, IdleSleepsUntilMaxSleep) {
+    // Nothing to do and health check far away → one wake per MAX_SLEEP_MS, not per 1 ms
+    EXPECT_EQ(rf_task::sleep_ms(false, false, 1000, 1000 + packet::timing::RADIO_WATCHDOG_INTERVAL),
+              rf_task::MAX_SLEEP_MS);
+}
+
+TEST(RfTaskSleep, IdleSleepsUntilHealthDeadline) {
+    EXPECT_EQ(rf_task::sleep_ms(false, false, 1000, 1250), 250u);
+}
+
+TEST(RfTaskSleep, HealthDueDoesNotSleep) {
+    EXPECT_EQ(rf_task::sleep_ms(false, false, 5000, 5000), 0u);
+    EXPECT_EQ(rf_task::sleep_ms(false, false, 5001, 5000), 0u);
+}
+
+TEST(RfTaskSleep, TxInProgressPollsFallback) {
+    EXPECT_EQ(rf_task::sleep_ms(true, false, 1000, 6000), rf_task::TX_POLL_MS);
+}
+
+TEST(RfTaskSleep, PendingWorkNeverSleeps) {
+    EXPECT_EQ(rf_task::sleep_ms(false, true, 1000, 6000), 0u);
+    EXPECT_EQ(rf_task::sleep_ms(true, true, 1000, 6000), 0u);
+}
+
+TEST(RfTaskSleep, HandlesMillisWraparound) {
+    uint32_t now = UINT32_MAX - 100;
+    EXPECT_EQ(rf_task::sleep_ms(false, false, now, now + 300), 300u);
+}
+
+TEST(RfTaskSleep, IdleMinuteNeedsAtMostSixtyWakes) {
+    // Simulate one idle minute: the old loop woke 60000 times
+    uint32_t now = 0, next_health = packet::timing::RADIO_WATCHDOG_INTERVAL, wakes = 0;
+    while (now < 60000) {
+        uint32_t s = rf_task::sleep_ms(false, false, now, next_health);
+        if (s == 0) next_health = now + packet::timing::RADIO_WATCHDOG_INTERVAL;
+        now += s;
+        wakes++;
+    }
+    EXPECT_LE(wakes, 60u + 60000u / packet::timing::RADIO_WATCHDOG_INTERVAL);
+}
+
+// =============================================================================
+// 2. LOAD METER
+// =============================================================================
+
+TEST(RfTaskLoad, CountsWakes) {
+    rf_task::LoadMeter load;
+    for (uint32_t i = 1; i <= 5; ++i) load.on_wake(1000, i * 1000);
+    EXPECT_EQ(load.wakes, 5u);
+}
+
+TEST(RfTaskLoad, IdleFractionOverWindow) {
+    rf_task::LoadMeter load;
+    // 900 ms asleep + 100 ms busy per second, for 11 seconds
+    uint32_t t = 0;
+    for (int i = 0; i < 11; ++i) {
+        t += 900000;
+        load.on_wake(900000, t);
+        t += 100000;
+    }
+    EXPECT_NEAR(load.idle_fraction, 0.9f, 0.02f);
+}
+
+TEST(RfTaskLoad, FullySleepingIsOne) {
+    rf_task::LoadMeter load;
+    uint32_t t = 0;
+    for (int i = 0; i < 12; ++i) {
+        t += 1000000;
+        load.on_wake(1000000, t);
+    }
+    EXPECT_FLOAT_EQ(load.idle_fraction, 1.0f);
+}
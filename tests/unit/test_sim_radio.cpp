@@ -0,0 +1,883 @@
+/// @file test_sim_radio.cpp
+/// @brief Load tests for DeviceRegistry + CommandSender against the simulated radio.
+///
+/// Uses the unity-build pattern from test_device_registry.cpp: stubs first, then
+/// production .cpp files #included directly. Elero::request_tx is routed into a
+/// SimHub that mirrors rf_task_func_() and Elero::loop() on the host:
+///
+///   main loop ── tx_queue (8) ──► RF step ── SimRadioDriver ── SimMedium ── SimBlind × N
+///   main loop ◄── rx_ring_ (16) ─┘        ◄── tx_done_queue (4)
+///
+/// Everything runs on MockTimeProvider in 1 ms steps, so runs are deterministic
+/// for a given SimMediumConfig::seed.
+
+#include <gtest/gtest.h>
+#include <vector>
+#include <string>
+#include <cstring>
+#include <deque>
+#include <algorithm>
+#include <memory>
+
+// ═══════════════════════════════════════════════════════════════════════════════
+// ESPHome stubs — must come before any production includes
+// ═══════════════════════════════════════════════════════════════════════════════
+
+#define ESP_LOGV(tag, format, ...) ((void)0)
+#define ESP_LOGVV(tag, format, ...) ((void)0)
+#define ESP_LOGD(tag, format, ...) ((void)0)
+#define ESP_LOGI(tag, format, ...) ((void)0)
+#define ESP_LOGW(tag, format, ...) ((void)0)
+#define ESP_LOGE(tag, format, ...) ((void)0)
+#define LOG_PIN(msg, pin) ((void)0)
+#define ESP_LOGCONFIG(tag, format, ...) ((void)0)
+#define IRAM_ATTR
+
+#ifndef UNIT_TEST
+#define UNIT_TEST
+#endif
+
+#include "elero/time_provider.h"
+
+namespace esphome {
+
+uint32_t millis() { return esphome::elero::get_time_provider().millis(); }
+uint32_t fnv1_hash(const std::string &str) {
+    uint32_t hash = 2166136261u;
+    for (char c : str) { hash = (hash * 16777619u) ^ static_cast<uint8_t>(c); }
+    return hash;
+}
+
+class InternalGPIOPin {
+ public:
+  void setup() {}
+  template<typename... Args> void attach_interrupt(Args &&...) {}
+};
+
+namespace gpio {
+enum InterruptType { INTERRUPT_FALLING_EDGE };
+}  // namespace gpio
+
+namespace setup_priority {
+constexpr float DATA = 0.0f;
+}
+
+}  // namespace esphome
+
+// ═══════════════════════════════════════════════════════════════════════════════
+// Unity build — real production code compiled here
+// ═══════════════════════════════════════════════════════════════════════════════
+
+#include "elero/cover_sm.cpp"
+#include "elero/light_sm.cpp"
+#include "elero/state_snapshot.cpp"
+#include "elero/device_registry.cpp"
+#include "elero/sim_radio_driver.h"
+#include "elero/lbt.h"
+
+using namespace esphome::elero;
+namespace pkt = esphome::elero::packet;
+
+// ═══════════════════════════════════════════════════════════════════════════════
+// SimHub — host mirror of the RF task + hub loop
+// ═══════════════════════════════════════════════════════════════════════════════
+
+class SimHub {
+ public:
+    static constexpr size_t TX_QUEUE_DEPTH = 8;       ///< Elero::setup() tx_queue
+    static constexpr size_t TX_DONE_QUEUE_DEPTH = 4;  ///< Elero::setup() tx_done_queue
+
+    SimHub(SimMedium &medium, DeviceRegistry &registry) : radio(medium), medium_(medium), registry_(registry) {
+        radio.init();
+        registry_.set_radio_bitrate(radio.bitrate_bps());  // Elero::setup()
+    }
+
+    /// Elero::request_tx() — non-blocking post to the RF task queue.
+    bool request_tx(TxClient *client, const EleroCommand &cmd) {
+        if (tx_queue_.size() >= TX_QUEUE_DEPTH) {
+            tx_queue_rejects++;
+            return false;
+        }
+        tx_queue_.push_back({client, cmd, 0, 0});
+        return true;
+    }
+
+    /// Elero::request_tx_burst() — one request for all repeats of a command.
+    bool request_tx_burst(TxClient *client, const EleroCommand &cmd, uint8_t packets, uint8_t gap_ms) {
+        if (tx_queue_.size() >= TX_QUEUE_DEPTH) {
+            tx_queue_rejects++;
+            return false;
+        }
+        tx_queue_.push_back({client, cmd, packets, gap_ms});
+        return true;
+    }
+
+    /// Elero::abort_tx() — checked by the RF task between burst packets.
+    void abort_tx(TxClient *client) { tx_abort_ = client; }
+
+    /// Advance simulated time by @p ms, stepping the medium and RF task every
+    /// millisecond and the main loop every loop_interval_ms.
+    void run_for(uint32_t ms, MockTimeProvider &time) {
+        for (uint32_t i = 0; i < ms; ++i) {
+            time.advance(1);
+            medium_.update();
+            rf_step_();
+            if (time.current_time % loop_interval_ms == 0) main_loop_();
+        }
+    }
+
+    SimRadioDriver radio;
+    ListenBeforeTalk lbt;
+    uint32_t loop_interval_ms{16};  ///< ESPHome default loop interval
+
+    uint32_t tx_queue_rejects{0};
+    uint32_t rx_queue_drops{0};
+    uint32_t tx_done_drops{0};
+    uint32_t tx_ok{0};
+    uint32_t tx_fail{0};
+    uint32_t rx_packets{0};
+    std::vector<uint32_t> tx_start_ms;  ///< millis() of every load_and_transmit()
+    std::vector<const TxClient *> tx_owners;  ///< Requesting client of every load_and_transmit()
+
+ private:
+    struct Request {
+        TxClient *client;
+        EleroCommand cmd;
+        uint8_t burst_packets;  ///< 0 = single TX (request_tx)
+        uint8_t burst_gap_ms;
+    };
+    struct Result {
+        TxClient *client;
+        bool success;
+        TxBurstReport burst;
+    };
+
+    uint32_t lbt_rng_{1};  ///< LCG for the LBT backoff jitter (deterministic runs)
+    uint32_t airtime_us_{0};       ///< Elero::stat_airtime_us_
+    uint32_t airtime_seen_us_{0};  ///< Elero::airtime_seen_us_
+
+    /// rf_task_func_() steps 1–5.
+    void rf_step_() {
+        uint32_t now = esphome::millis();
+        if (!tx_in_progress_ && !burst_.active() && !tx_queue_.empty()) {
+            Request req = tx_queue_.front();
+            tx_queue_.pop_front();
+            msg_tx_len_ = build_command_packet(req.cmd, msg_tx_);
+            tx_owner_ = req.client;
+            burst_report_ = req.burst_packets > 0;
+            burst_.start(burst_report_ ? req.burst_packets : 1, req.burst_gap_ms, now);
+        }
+
+        if (!tx_in_progress_ && tx_owner_ != nullptr && tx_abort_ == tx_owner_ && burst_.abort()) {
+            tx_abort_ = nullptr;
+        }
+        if (!tx_in_progress_ && burst_.due(now) && lbt.enabled()) {
+            int16_t rssi = 0;
+            bool sampled = radio.sample_rssi(rssi);
+            lbt_rng_ = lbt_rng_ * 1103515245u + 12345u;
+            uint32_t wait = lbt.check(sampled, rssi, now, lbt_rng_ >> 16);
+            if (wait > 0) burst_.defer(now + wait);
+        }
+        if (!tx_in_progress_ && burst_.due(now)) {
+            if (msg_tx_len_ > 0 && radio.load_and_transmit(msg_tx_, msg_tx_len_)) {
+                tx_in_progress_ = true;
+                tx_start_ms.push_back(now);
+                tx_owners.push_back(tx_owner_);
+            } else {
+                burst_.on_packet_done(false, now);
+            }
+        }
+
+        if (tx_in_progress_) {
+            auto result = radio.poll_tx();
+            if (result != TxPollResult::PENDING) {
+                airtime_us_ += radio.airtime_us(msg_tx_len_);
+                tx_in_progress_ = false;
+                burst_.on_packet_done(result == TxPollResult::SUCCESS, now);
+            }
+        }
+
+        if (burst_.finished()) {
+            const TxBurstReport &report = burst_.report();
+            post_result_({tx_owner_, report.all_ok(), burst_report_ ? report : TxBurstReport{}});
+            tx_owner_ = nullptr;
+            burst_.clear();
+        }
+
+        while (radio.has_data()) {
+            size_t n = radio.read_fifo(msg_rx_, sizeof(msg_rx_));
+            if (n == 0) break;
+            decode_(n);
+        }
+    }
+
+    /// Elero::decode_fifo_packets_() equivalent — decode into an rx_ring_ slot.
+    void decode_(size_t n) {
+        auto r = pkt::parse_packet(msg_rx_, n);
+        if (!r.valid) return;
+        RfPacketInfo *slot = rx_ring_.acquire();
+        if (slot == nullptr) {
+            rx_queue_drops++;
+            return;
+        }
+        RfPacketInfo &info = *slot;
+        info.timestamp_ms = esphome::millis();
+        info.src = r.src_addr;
+        info.dst = r.dst_addr;
+        info.channel = r.channel;
+        info.type = r.type;
+        info.type2 = r.type2;
+        bool is_cmd = pkt::is_command_packet(r.type) || pkt::is_button_packet(r.type);
+        info.command = is_cmd ? r.payload[pkt::payload_offset::COMMAND] : 0;
+        info.state = pkt::is_status_packet(r.type) ? r.payload[pkt::payload_offset::STATE] : 0;
+        info.cnt = r.counter;
+        info.rssi = r.rssi;
+        info.lqi = r.lqi;
+        info.crc_ok = r.crc_ok != 0;
+        info.hop = r.hop;
+        memcpy(info.payload, r.payload, sizeof(info.payload));
+        info.raw_len = static_cast<uint8_t>(n);
+        RfRawFrame *raw = registry_.raw_capture_wanted() ? raw_ring_.acquire() : nullptr;
+        if (raw != nullptr) {
+            raw->len = static_cast<uint8_t>(n);
+            memcpy(raw->bytes, msg_rx_, n);
+            raw_ring_.commit();
+        }
+        info.raw = raw;
+        rx_ring_.commit();
+    }
+
+    void post_result_(const Result &r) {
+        if (tx_done_queue_.size() >= TX_DONE_QUEUE_DEPTH) {
+            tx_done_drops++;
+            return;
+        }
+        tx_done_queue_.push_back(r);
+    }
+
+    /// Elero::loop() steps 1–3.
+    void main_loop_() {
+        uint32_t now = esphome::millis();
+        registry_.begin_batch();
+        while (const RfPacketInfo *pkt = rx_ring_.front()) {
+            rx_packets++;
+            registry_.on_rf_packet(*pkt, now);
+            if (pkt->raw != nullptr) raw_ring_.pop();
+            rx_ring_.pop();
+        }
+        while (!tx_done_queue_.empty()) {
+            Result r = tx_done_queue_.front();
+            tx_done_queue_.pop_front();
+            if (tx_abort_ == r.client) tx_abort_ = nullptr;
+            if (r.burst.packets > 0) {
+                tx_ok += r.burst.sent_ok();
+                tx_fail += r.burst.packets - r.burst.sent_ok();
+                if (r.client != nullptr) r.client->on_tx_burst_complete(r.burst);
+                continue;
+            }
+            r.success ? tx_ok++ : tx_fail++;
+            if (r.client != nullptr) r.client->on_tx_complete(r.success);
+        }
+        registry_.on_tx_airtime(now, airtime_us_ - airtime_seen_us_);
+        airtime_seen_us_ = airtime_us_;
+        registry_.loop(now);
+    }
+
+    SimMedium &medium_;
+    DeviceRegistry &registry_;
+    std::deque<Request> tx_queue_;
+    SpscRing<RfPacketInfo, RX_RING_SIZE> rx_ring_;
+    SpscRing<RfRawFrame, RAW_RING_SIZE> raw_ring_;
+    std::deque<Result> tx_done_queue_;
+    TxClient *tx_owner_{nullptr};
+    TxClient *tx_abort_{nullptr};
+    TxBurst burst_;
+    bool burst_report_{false};
+    bool tx_in_progress_{false};
+    size_t msg_tx_len_{0};
+    uint8_t msg_tx_[pkt::FIFO_LENGTH]{};
+    uint8_t msg_rx_[pkt::FIFO_LENGTH]{};
+};
+
+static SimHub *g_sim_hub = nullptr;
+
+// Stub Elero methods (device_registry.cpp includes elero.h)
+namespace esphome {
+namespace elero {
+
+bool Elero::request_tx(TxClient *client, const EleroCommand &cmd) {
+    return g_sim_hub != nullptr && g_sim_hub->request_tx(client, cmd);
+}
+
+bool Elero::request_tx_burst(TxClient *client, const EleroCommand &cmd, uint8_t packets, uint8_t gap_ms) {
+    return g_sim_hub != nullptr && g_sim_hub->request_tx_burst(client, cmd, packets, gap_ms);
+}
+
+void Elero::abort_tx(TxClient *client) {
+    if (g_sim_hub != nullptr) g_sim_hub->abort_tx(client);
+}
+
+void Elero::setup() {}
+void Elero::loop() {}
+void Elero::dump_config() {}
+void Elero::dispatch_packet(const RfPacketInfo &) {}
+bool Elero::send_raw_command(uint32_t, uint32_t, uint8_t, uint8_t, uint8_t, uint8_t, uint8_t, uint8_t, uint8_t) { return false; }
+void Elero::reinit_frequency(uint8_t, uint8_t, uint8_t) {}
+
+}  // namespace elero
+
+ESPPreferences prefs_instance_;
+ESPPreferences *global_preferences = &prefs_instance_;
+
+}  // namespace esphome
+
+// ═══════════════════════════════════════════════════════════════════════════════
+// Helpers
+// ═══════════════════════════════════════════════════════════════════════════════
+
+static constexpr uint32_t REMOTE_ADDR = 0xF0D008;
+static constexpr uint32_t BLIND_BASE_ADDR = 0xA00000;
+
+static NvsDeviceConfig make_cover_config(uint32_t addr, uint8_t channel) {
+    NvsDeviceConfig cfg{};
+    cfg.type = DeviceType::COVER;
+    cfg.dst_address = addr;
+    cfg.src_address = REMOTE_ADDR;
+    cfg.channel = channel;
+    cfg.open_duration_ms = 20000;
+    cfg.close_duration_ms = 20000;
+    snprintf(cfg.name, NVS_NAME_MAX, "Cover %u", static_cast<unsigned>(channel));
+    return cfg;
+}
+
+static SimBlindConfig make_blind_config(uint32_t addr, uint8_t channel, float start_position) {
+    SimBlindConfig cfg;
+    cfg.address = addr;
+    cfg.remote_address = REMOTE_ADDR;
+    cfg.channel = channel;
+    cfg.travel_ms = 20000;
+    cfg.start_position = start_position;
+    return cfg;
+}
+
+// ═══════════════════════════════════════════════════════════════════════════════
+// Fixture
+// ═══════════════════════════════════════════════════════════════════════════════
+
+class SimRadioTest : public ::testing::Test {
+ protected:
+    MockTimeProvider mock_time_;
+    DeviceRegistry registry_;
+    Elero hub_;
+    std::unique_ptr<SimMedium> medium_;
+    std::unique_ptr<SimHub> sim_;
+    std::vector<std::unique_ptr<SimBlind>> blinds_;
+
+    void SetUp() override {
+        set_time_provider(&mock_time_);
+        mock_time_.reset();
+        mock_time_.current_time = 1;  // last_seen_ms == 0 means "never heard"
+        registry_.set_hub(&hub_);
+    }
+
+    void TearDown() override {
+        g_sim_hub = nullptr;
+        set_time_provider(nullptr);
+    }
+
+    void build(const SimMediumConfig &cfg = {}) {
+        medium_ = std::make_unique<SimMedium>(cfg);
+        sim_ = std::make_unique<SimHub>(*medium_, registry_);
+        g_sim_hub = sim_.get();
+    }
+
+    /// Register a cover and its simulated blind (same address/channel).
+    Device *add_pair(uint8_t idx, float start_position = 0.0f) {
+        uint32_t addr = BLIND_BASE_ADDR + idx;
+        uint8_t channel = idx + 1;
+        blinds_.push_back(std::make_unique<SimBlind>(*medium_, make_blind_config(addr, channel, start_position)));
+        return registry_.register_device(make_cover_config(addr, channel));
+    }
+
+    void run_for(uint32_t ms) { sim_->run_for(ms, mock_time_); }
+};
+
+// ═══════════════════════════════════════════════════════════════════════════════
+// Medium
+// ═══════════════════════════════════════════════════════════════════════════════
+
+TEST_F(SimRadioTest, Airtime_MatchesCc1101DataRate) {
+    build();
+    // 12 preamble + 4 sync + 30 (len + 0x6A body) + 2 CRC = 48 bytes = 384 bits @ 76.8 kBaud
+    EXPECT_EQ(medium_->airtime_ms(pkt::TX_MSG_LENGTH + 1), 5u);
+}
+
+TEST_F(SimRadioTest, OverlappingFrames_Collide) {
+    build();
+    SimRadioDriver a(*medium_), b(*medium_), listener(*medium_);
+    uint8_t buf[pkt::FIFO_LENGTH];
+    pkt::TxParams params;
+    size_t len = pkt::build_tx_packet(params, buf);
+
+    ASSERT_TRUE(a.load_and_transmit(buf, len));
+    mock_time_.advance(2);
+    ASSERT_TRUE(b.load_and_transmit(buf, len));
+    for (int i = 0; i < 20; ++i) {
+        mock_time_.advance(1);
+        medium_->update();
+    }
+
+    EXPECT_EQ(medium_->stats().frames_collided, 2u);
+    EXPECT_FALSE(listener.has_data());
+}
+
+TEST_F(SimRadioTest, SequentialFrames_Delivered) {
+    build();
+    SimRadioDriver a(*medium_), listener(*medium_);
+    uint8_t buf[pkt::FIFO_LENGTH];
+    pkt::TxParams params;
+    size_t len = pkt::build_tx_packet(params, buf);
+
+    ASSERT_TRUE(a.load_and_transmit(buf, len));
+    EXPECT_EQ(a.poll_tx(), TxPollResult::PENDING);
+    mock_time_.advance(medium_->airtime_ms(len));
+    medium_->update();
+    EXPECT_EQ(a.poll_tx(), TxPollResult::SUCCESS);
+
+    ASSERT_TRUE(listener.has_data());
+    uint8_t rx[pkt::FIFO_LENGTH];
+    size_t n = listener.read_fifo(rx, sizeof(rx));
+    auto r = pkt::parse_packet(rx, n);
+    ASSERT_TRUE(r.valid);
+    EXPECT_TRUE(r.crc_ok);
+    EXPECT_FLOAT_EQ(r.rssi, -60.0f);
+}
+
+// ═══════════════════════════════════════════════════════════════════════════════
+// Raw frame capture on demand
+// ═══════════════════════════════════════════════════════════════════════════════
+
+namespace {
+
+struct RawRecorder : public OutputAdapter {
+    void setup(DeviceRegistry &) override {}
+    void loop() override {}
+    void on_device_added(const Device &) override {}
+    void on_device_removed(const Device &) override {}
+    void on_state_changed(const Device &, uint16_t) override {}
+    void on_rf_packet(const RfPacketInfo &pkt) override {
+        if (pkt.raw == nullptr) {
+            without_raw++;
+            return;
+        }
+        with_raw++;
+        auto r = pkt::parse_packet(pkt.raw->bytes, pkt.raw->len);
+        raw_matches += r.valid && r.src_addr == pkt.src && r.counter == pkt.cnt;
+    }
+    int with_raw{0};
+    int without_raw{0};
+    int raw_matches{0};
+};
+
+}  // namespace
+
+TEST_F(SimRadioTest, RawCapture_OnlyWhileAnAdapterWantsIt) {
+    build();
+    RawRecorder rec;
+    registry_.add_adapter(&rec);
+    auto *dev = add_pair(0, 1.0f);
+
+    registry_.request_check(*dev);
+    run_for(500);
+    EXPECT_GT(rec.without_raw, 0);
+    EXPECT_EQ(rec.with_raw, 0);
+
+    registry_.acquire_raw_capture();
+    EXPECT_TRUE(registry_.raw_capture_wanted());
+    registry_.request_check(*dev);
+    run_for(500);
+    EXPECT_GT(rec.with_raw, 0);
+    EXPECT_EQ(rec.raw_matches, rec.with_raw);
+
+    registry_.release_raw_capture();
+    EXPECT_FALSE(registry_.raw_capture_wanted());
+    int before = rec.with_raw;
+    registry_.request_check(*dev);
+    run_for(500);
+    EXPECT_EQ(rec.with_raw, before);
+}
+
+TEST_F(SimRadioTest, Burst_SpacingIndependentOfLoopInterval) {
+    build();
+    sim_->loop_interval_ms = 50;  // Busy ESPHome loop
+    registry_.set_ack_aware_repeats(false);  // Keep all three repeats
+    auto *dev = add_pair(0, 0.0f);
+    registry_.command_cover(*dev, pkt::command::UP);
+    run_for(500);
+
+    // The three UP repeats are spaced by airtime + INTER_PACKET_MS on the RF
+    // task clock, not by main loop ticks
+    ASSERT_GE(sim_->tx_start_ms.size(), static_cast<size_t>(pkt::button::PACKETS));
+    uint32_t d1 = sim_->tx_start_ms[1] - sim_->tx_start_ms[0];
+    uint32_t d2 = sim_->tx_start_ms[2] - sim_->tx_start_ms[1];
+    EXPECT_EQ(d1, d2);
+    EXPECT_GE(d1, pkt::button::INTER_PACKET_MS);
+    EXPECT_LT(d1, sim_->loop_interval_ms);
+    EXPECT_EQ(blinds_[0]->commands_received(), 2u);  // UP (repeats deduped) + CHECK
+    EXPECT_EQ(sim_->tx_fail, 0u);
+}
+
+// ═══════════════════════════════════════════════════════════════════════════════
+// Registry ↔ blind round trips
+// ═══════════════════════════════════════════════════════════════════════════════
+
+TEST_F(SimRadioTest, Check_BlindRepliesAndRegistryUpdates) {
+    build();
+    auto *dev = add_pair(0, 1.0f);
+    registry_.request_check(*dev);
+    run_for(500);
+
+    EXPECT_EQ(blinds_[0]->commands_received(), 1u);
+    EXPECT_EQ(blinds_[0]->replies_sent(), 1u);
+    EXPECT_GT(dev->rf.last_seen_ms, 0u);
+    EXPECT_EQ(dev->rf.last_state_raw, pkt::state::TOP);
+}
+
+TEST_F(SimRadioTest, CoverUp_BlindTravelsAndPollsSeeTop) {
+    build();
+    auto *dev = add_pair(0, 0.0f);
+    registry_.command_cover(*dev, pkt::command::UP);
+    run_for(1000);
+    EXPECT_TRUE(blinds_[0]->moving());
+    EXPECT_EQ(dev->rf.last_state_raw, pkt::state::MOVING_UP);
+
+    run_for(25000);
+    EXPECT_FLOAT_EQ(blinds_[0]->position(), 1.0f);
+    EXPECT_EQ(dev->rf.last_state_raw, pkt::state::TOP);
+    EXPECT_FALSE(cover_sm::is_moving(std::get<CoverDevice>(dev->logic).state));
+}
+
+TEST_F(SimRadioTest, TotalLoss_RegistryNeverHearsBack) {
+    SimMediumConfig cfg;
+    cfg.loss_per_mille = 1000;
+    build(cfg);
+    auto *dev = add_pair(0);
+    registry_.request_check(*dev);
+    run_for(2000);
+
+    EXPECT_EQ(blinds_[0]->commands_received(), 0u);
+    EXPECT_EQ(dev->rf.last_seen_ms, 0u);
+    EXPECT_GT(medium_->stats().frames_lost, 0u);
+    EXPECT_GT(sim_->tx_ok, 0u);  // TX itself still completes — loss is on the air
+}
+
+TEST_F(SimRadioTest, SameSeed_Reproducible) {
+    auto run_once = [&]() {
+        DeviceRegistry registry;
+        registry.set_hub(&hub_);
+        mock_time_.current_time = 1;
+        SimMediumConfig cfg;
+        cfg.loss_per_mille = 200;
+        cfg.seed = 42;
+        SimMedium medium(cfg);
+        SimHub sim(medium, registry);
+        g_sim_hub = &sim;
+        std::vector<std::unique_ptr<SimBlind>> blinds;
+        for (uint8_t i = 0; i < 8; ++i) {
+            uint32_t addr = BLIND_BASE_ADDR + i;
+            blinds.push_back(std::make_unique<SimBlind>(medium, make_blind_config(addr, i + 1, 0.0f)));
+            registry.command_cover(*registry.register_device(make_cover_config(addr, i + 1)), pkt::command::UP);
+        }
+        sim.run_for(10000, mock_time_);
+        g_sim_hub = nullptr;
+        return medium.stats();
+    };
+    auto s1 = run_once();
+    auto s2 = run_once();
+    EXPECT_GT(s1.frames_lost, 0u);
+    EXPECT_EQ(s1.frames_sent, s2.frames_sent);
+    EXPECT_EQ(s1.frames_delivered, s2.frames_delivered);
+    EXPECT_EQ(s1.frames_lost, s2.frames_lost);
+    EXPECT_EQ(s1.frames_collided, s2.frames_collided);
+}
+
+// ═══════════════════════════════════════════════════════════════════════════════
+// Fleet load — the whole house at once
+// ═══════════════════════════════════════════════════════════════════════════════
+
+TEST_F(SimRadioTest, CloseAll_CoalescedIntoOneGroupPress) {
+    build();
+    constexpr uint8_t COUNT = 12;
+    std::vector<Device *> devs;
+    for (uint8_t i = 0; i < COUNT; ++i) devs.push_back(add_pair(i, 1.0f));
+    for (auto *dev : devs) registry_.command_cover(*dev, pkt::command::DOWN);
+    run_for(1000);
+
+    // One 3-packet group press + one CHECK per cover, instead of 12 × (3 + 1)
+    EXPECT_EQ(sim_->tx_start_ms.size(), pkt::button::PACKETS + COUNT);
+    for (uint8_t i = 0; i < COUNT; ++i) {
+        SCOPED_TRACE(i);
+        EXPECT_TRUE(blinds_[i]->moving());
+    }
+}
+
+TEST_F(SimRadioTest, Scene_EndpointsAndIntermediateReachTargets) {
+    build();
+    std::vector<Device *> devs;
+    for (uint8_t i = 0; i < 4; ++i) devs.push_back(add_pair(i, 1.0f));
+    // Sync the registry with the real (open) positions
+    for (auto *dev : devs) registry_.request_check(*dev);
+    run_for(2000);
+
+    const SceneEntry scene[] = {{devs[0], 0.0f}, {devs[1], 0.0f}, {devs[2], 0.0f}, {devs[3], 0.5f}};
+    size_t tx_before = sim_->tx_start_ms.size();
+    auto result = registry_.apply_scene(scene);
+    EXPECT_EQ(result.packets, 1u);  // All four start DOWN from the same remote
+    EXPECT_EQ(result.completion_ms, 20000u);
+    run_for(1000);
+    // One press, then one scheduler-spaced CHECK per cover (the first was
+    // granted during the press and waited for it)
+    ASSERT_EQ(sim_->tx_start_ms.size() - tx_before, pkt::button::PACKETS + 4u);
+    for (size_t i = tx_before + pkt::button::PACKETS + 2; i < sim_->tx_start_ms.size(); ++i) {
+        EXPECT_GE(sim_->tx_start_ms[i] - sim_->tx_start_ms[i - 1], registry_.poll_scheduler().gap_ms());
+    }
+
+    run_for(30000);
+    for (uint8_t i = 0; i < 3; ++i) {
+        SCOPED_TRACE(i);
+        EXPECT_FLOAT_EQ(blinds_[i]->position(), 0.0f);
+    }
+    EXPECT_NEAR(blinds_[3]->position(), 0.5f, 0.05f);
+}
+
+TEST_F(SimRadioTest, Fleet40_AllUp_RegistryStaysConsistent) {
+    // Loss-free medium: every miss below is airtime contention (collisions with
+    // blind replies, hub deaf while transmitting), not random loss.
+    SimMediumConfig cfg;
+    cfg.latency_ms = 1;
+    build(cfg);
+
+    constexpr uint8_t FLEET = 40;
+    std::vector<Device *> devs;
+    for (uint8_t i = 0; i < FLEET; ++i) devs.push_back(add_pair(i, 0.0f));
+    for (auto *dev : devs) registry_.command_cover(*dev, pkt::command::UP);
+
+    // Long enough for every blind to finish travelling and be polled again
+    run_for(240000);
+
+    int missed_up = 0;
+    int stale = 0;
+    for (uint8_t i = 0; i < FLEET; ++i) {
+        SCOPED_TRACE(i);
+        EXPECT_GT(blinds_[i]->commands_received(), 0u);
+        EXPECT_GT(devs[i]->rf.last_seen_ms, 0u);
+        EXPECT_EQ(devs[i]->sender.queue_size(), 0u);
+        // Never report an end position the blind is not actually in
+        if (devs[i]->rf.last_state_raw == pkt::state::TOP) {
+            EXPECT_FLOAT_EQ(blinds_[i]->position(), 1.0f);
+        }
+        if (devs[i]->rf.last_state_raw == pkt::state::BOTTOM) {
+            EXPECT_FLOAT_EQ(blinds_[i]->position(), 0.0f);
+        }
+        if (blinds_[i]->position() < 1.0f) ++missed_up;
+        if (devs[i]->rf.last_state_raw != blinds_[i]->state_byte()) ++stale;
+    }
+    // UP is coalesced into two group presses; the 40 follow-up CHECKs wait in
+    // the registry's TX scheduler instead of overflowing the 8-deep TX queue
+    EXPECT_EQ(sim_->tx_queue_rejects, 0u);
+    EXPECT_EQ(sim_->tx_done_drops, 0u);
+    EXPECT_EQ(sim_->tx_fail, 0u);
+
+    const auto &st = medium_->stats();
+    RecordProperty("frames_sent", static_cast<int>(st.frames_sent));
+    RecordProperty("frames_collided", static_cast<int>(st.frames_collided));
+    RecordProperty("airtime_ms", static_cast<int>(st.airtime_ms));
+    RecordProperty("tx_queue_rejects", static_cast<int>(sim_->tx_queue_rejects));
+    RecordProperty("rx_queue_drops", static_cast<int>(sim_->rx_queue_drops));
+    RecordProperty("rx_fifo_overflows", static_cast<int>(sim_->radio.overflow_count()));
+    RecordProperty("blinds_missed_up", missed_up);
+    RecordProperty("registry_stale", stale);
+    RecordProperty("polls_sent", static_cast<int>(registry_.poll_scheduler().polls_total()));
+    RecordProperty("polls_missed", static_cast<int>(registry_.poll_scheduler().missed_total()));
+}
+
+TEST_F(SimRadioTest, Fleet40_StopOvertakesQueuedChecks) {
+    build();
+    constexpr uint8_t FLEET = 40;
+    std::vector<Device *> devs;
+    for (uint8_t i = 0; i < FLEET; ++i) devs.push_back(add_pair(i, 0.0f));
+    for (auto *dev : devs) registry_.command_cover(*dev, pkt::command::UP);
+    run_for(200);
+    ASSERT_TRUE(blinds_[FLEET - 1]->moving());
+    const auto &tx = registry_.tx_scheduler();
+    // More follow-up CHECKs waiting than the RF task queue could even hold
+    EXPECT_GT(tx.queued_count(), SimHub::TX_QUEUE_DEPTH);
+
+    // The last slot's STOP goes out next instead of behind every queued CHECK
+    registry_.command_cover(*devs[FLEET - 1], pkt::command::STOP);
+    uint32_t stop_ms = 0;
+    while (blinds_[FLEET - 1]->moving() && stop_ms < 2000) {
+        run_for(1);
+        ++stop_ms;
+    }
+    EXPECT_LT(stop_ms, 2 * sim_->loop_interval_ms);
+    EXPECT_EQ(tx.sent_total(TxClass::SAFETY), 1u);
+    EXPECT_LE(tx.max_delay_ms(TxClass::SAFETY), sim_->loop_interval_ms);
+    EXPECT_GT(tx.max_delay_ms(TxClass::FOLLOW_UP), tx.max_delay_ms(TxClass::SAFETY));
+
+    RecordProperty("stop_latency_ms", static_cast<int>(stop_ms));
+    RecordProperty("check_max_delay_ms", static_cast<int>(tx.max_delay_ms(TxClass::FOLLOW_UP)));
+}
+
+TEST_F(SimRadioTest, AckAware_BlindReplyCutsRepeatsAndFollowUpCheck) {
+    build();
+    auto *dev = add_pair(0, 0.0f);
+    registry_.command_cover(*dev, pkt::command::UP);
+    run_for(1000);
+
+    // Without acks: PACKETS repeats + follow-up CHECK. The MOVING_UP reply to
+    // an early repeat ends the exchange instead.
+    EXPECT_LT(sim_->tx_start_ms.size(), pkt::button::PACKETS + 1u);
+    EXPECT_EQ(blinds_[0]->commands_received(), 1u);
+    EXPECT_TRUE(blinds_[0]->moving());
+    EXPECT_EQ(dev->rf.last_state_raw, pkt::state::MOVING_UP);
+    EXPECT_FALSE(dev->sender.is_busy());
+}
+
+TEST_F(SimRadioTest, AckAware_AbortBeforeBurstStartIsKept) {
+    build();
+    registry_.set_coalesce_window(0);
+    auto *dev0 = add_pair(0, 0.0f);
+    auto *dev1 = add_pair(1, 0.0f);
+    registry_.command_cover(*dev0, pkt::command::UP);
+    registry_.command_cover(*dev1, pkt::command::UP);
+    run_for(sim_->loop_interval_ms + 1);
+    // Both posted; dev0's burst is on air, dev1's waits in the RF task queue
+    ASSERT_TRUE(registry_.tx_scheduler().in_flight(1));
+    ASSERT_EQ(sim_->tx_owners.size(), 1u);
+    ASSERT_EQ(sim_->tx_owners.front(), &dev0->sender);
+
+    // dev1's blind reports MOVING_UP before our UP to it went out
+    RfPacketInfo status{};
+    status.timestamp_ms = mock_time_.millis();
+    status.src = blinds_[1]->config().address;
+    status.dst = 0xF0D008;
+    status.type = pkt::msg_type::STATUS;
+    status.state = pkt::state::MOVING_UP;
+    status.rssi = -60.0f;
+    registry_.on_rf_packet(status, mock_time_.millis());
+    run_for(1000);
+
+    // The abort outlives dev0's burst: dev1 gets a single packet, no CHECK
+    EXPECT_EQ(std::count(sim_->tx_owners.begin(), sim_->tx_owners.end(), &dev1->sender), 1);
+    EXPECT_FALSE(dev1->sender.is_busy());
+    EXPECT_TRUE(blinds_[1]->moving());
+}
+
+// ═══════════════════════════════════════════════════════════════════════════════
+// Listen-before-talk
+// ═══════════════════════════════════════════════════════════════════════════════
+
+/// Foreign transmitter keeping the channel busy with back-to-back frames.
+class SimJammer : public SimNode {
+ public:
+    SimJammer(SimMedium &medium, uint32_t until_ms) : medium_(medium), until_ms_(until_ms) {
+        medium.attach(this);
+        len_ = pkt::build_tx_packet(pkt::TxParams{}, frame_);
+    }
+    void on_frame(const uint8_t *, size_t) override {}
+    void on_tick(uint32_t now) override {
+        if (now < until_ms_ && now >= next_ms_) next_ms_ = medium_.transmit(this, frame_, len_);
+    }
+
+ private:
+    SimMedium &medium_;
+    uint32_t until_ms_;
+    uint32_t next_ms_{0};
+    uint8_t frame_[pkt::FIFO_LENGTH]{};
+    size_t len_{0};
+};
+
+TEST_F(SimRadioTest, Lbt_DefersUntilChannelClears) {
+    build();
+    registry_.set_coalesce_window(0);
+    auto *dev = add_pair(0, 0.0f);
+    SimJammer jammer(*medium_, mock_time_.millis() + 30);
+    run_for(2);
+    registry_.command_cover(*dev, pkt::command::UP);
+    run_for(1000);
+
+    EXPECT_GT(sim_->lbt.busy_total(), 0u);
+    EXPECT_EQ(sim_->lbt.forced_total(), 0u);
+    ASSERT_FALSE(sim_->tx_start_ms.empty());
+    EXPECT_GE(sim_->tx_start_ms.front(), 30u);
+    EXPECT_EQ(medium_->stats().frames_collided, 0u);
+    EXPECT_TRUE(blinds_[0]->moving());
+}
+
+TEST_F(SimRadioTest, Lbt_DisabledCollidesWithBusyChannel) {
+    build();
+    sim_->lbt.set_enabled(false);
+    registry_.set_coalesce_window(0);
+    auto *dev = add_pair(0, 0.0f);
+    SimJammer jammer(*medium_, mock_time_.millis() + 30);
+    run_for(2);
+    registry_.command_cover(*dev, pkt::command::UP);
+    run_for(1000);
+
+    EXPECT_GT(medium_->stats().frames_collided, 0u);
+}
+
+TEST_F(SimRadioTest, Lbt_StuckCarrierStillTransmits) {
+    build();
+    registry_.set_coalesce_window(0);
+    auto *dev = add_pair(0, 0.0f);
+    SimJammer jammer(*medium_, mock_time_.millis() + 5000);
+    run_for(2);
+    registry_.command_cover(*dev, pkt::command::UP);
+    run_for(500);
+
+    // Bounded deferral: the packets go out (and collide) instead of waiting forever
+    EXPECT_GT(sim_->lbt.forced_total(), 0u);
+    EXPECT_FALSE(sim_->tx_start_ms.empty());
+}
+
+// ═══════════════════════════════════════════════════════════════════════════════
+// Duty cycle
+// ═══════════════════════════════════════════════════════════════════════════════
+
+TEST_F(SimRadioTest, DutyCycle_PollStormStaysWithinBudgetCommandsStillGoOut) {
+    build();
+    registry_.set_coalesce_window(0);
+    registry_.set_poll_airtime_budget(1.0f);  // Poll scheduler alone would allow a storm
+    constexpr uint8_t FLEET = 40;
+    std::vector<Device *> devs;
+    for (uint8_t i = 0; i < FLEET; ++i) {
+        devs.push_back(add_pair(i, 0.0f));
+        auto &poll = std::get<CoverDevice>(devs.back()->logic).poll;
+        poll.interval_ms = 1000;
+        poll.offset_ms = 0;
+        registry_.wake(*devs.back());
+    }
+    run_for(90000);
+
+    // 40 polls/s would be ~20% airtime. Polls stop once the minute window's
+    // 1% share (600 ms) is spent and resume as its buckets expire; only the
+    // requests already handed to the RF task can overshoot.
+    const auto &duty = registry_.duty_cycle();
+    uint32_t now = mock_time_.millis();
+    uint32_t minute_budget_us = 600000;
+    uint32_t check_us = sim_->radio.airtime_us(pkt::TX_MSG_LENGTH + 1);
+    EXPECT_LE(duty.minute_us(now), minute_budget_us + tx_sched::MAX_IN_FLIGHT * check_us);
+    EXPECT_LE(duty.total_us(), 2 * (minute_budget_us + tx_sched::MAX_IN_FLIGHT * check_us));
+    EXPECT_GT(registry_.poll_scheduler().polls_total(), minute_budget_us / check_us);
+    EXPECT_GT(registry_.poll_scheduler().pending_count(), 0u);
+
+    // A user command is not held back by the exhausted poll share
+    registry_.command_cover(*devs[7], pkt::command::UP);
+    run_for(200);
+    EXPECT_TRUE(blinds_[7]->moving());
+
+    RecordProperty("polls_sent", static_cast<int>(registry_.poll_scheduler().polls_total()));
+    RecordProperty("airtime_minute_us", static_cast<int>(duty.minute_us(mock_time_.millis())));
+}
@@ -0,0 +1,149 @@
+/// @file test_spsc_ring.cpp
+/// @brief Unit tests for SpscRing — lock-free RF task → main loop RX ring.
+
+#include <gtest/gtest.h>
+#include <thread>
+
+#include "elero/spsc_ring.h"
+
+using namespace esphome::elero;
+
+namespace {
+
+struct Item {
+    uint32_t seq;
+    uint8_t raw[64];
+};
+
+}  // namespace
+
+// =============================================================================
+// 1. BASIC PRODUCE / CONSUME
+// =============================================================================
+
+TEST(SpscRing, StartsEmpty) {
+    SpscRing<Item, 4> ring;
+    EXPECT_TRUE(ring.empty());
+    EXPECT_EQ(ring.front(), nullptr);
+    EXPECT_EQ(ring.high_water(), 0u);
+    EXPECT_EQ(ring.capacity(), 4u);
+}
+
+TEST(SpscRing, SlotIsUsedInPlace) {
+    SpscRing<Item, 4> ring;
+    Item *slot = ring.acquire();
+    ASSERT_NE(slot, nullptr);
+    slot->seq = 42;
+
+    // Not visible until committed
+    EXPECT_EQ(ring.front(), nullptr);
+    ring.commit();
+
+    Item *front = ring.front();
+    ASSERT_EQ(front, slot);  // same storage, no copy
+    EXPECT_EQ(front->seq, 42u);
+    ring.pop();
+    EXPECT_TRUE(ring.empty());
+}
+
+TEST(SpscRing, AcquireWithoutCommitReusesSlot) {
+    // decode_fifo_packets_ acquires a slot, then skips commit() for invalid frames
+    SpscRing<Item, 4> ring;
+    Item *a = ring.acquire();
+    Item *b = ring.acquire();
+    EXPECT_EQ(a, b);
+    EXPECT_TRUE(ring.empty());
+}
+
+TEST(SpscRing, FullRingRejectsAcquire) {
+    SpscRing<Item, 4> ring;
+    for (uint32_t i = 0; i < 4; ++i) {
+        Item *slot = ring.acquire();
+        ASSERT_NE(slot, nullptr);
+        slot->seq = i;
+        ring.commit();
+    }
+    EXPECT_EQ(ring.acquire(), nullptr);
+    EXPECT_EQ(ring.size(), 4u);
+
+    ring.pop();
+    EXPECT_NE(ring.acquire(), nullptr);
+}
+
+TEST(SpscRing, FifoOrderAcrossWrap) {
+    SpscRing<Item, 4> ring;
+    uint32_t next_in = 0, next_out = 0;
+    for (int round = 0; round < 10; ++round) {
+        for (int i = 0; i < 3; ++i) {
+            ring.acquire()->seq = next_in++;
+            ring.commit();
+        }
+        while (Item *it = ring.front()) {
+            EXPECT_EQ(it->seq, next_out++);
+            ring.pop();
+        }
+    }
+    EXPECT_EQ(next_out, 30u);
+}
+
+// =============================================================================
+// 2. HIGH-WATER MARK
+// =============================================================================
+
+TEST(SpscRing, HighWaterTracksPeakDepth) {
+    SpscRing<Item, 8> ring;
+    for (int i = 0; i < 5; ++i) {
+        ring.acquire();
+        ring.commit();
+    }
+    for (int i = 0; i < 5; ++i) ring.pop();
+    ring.acquire();
+    ring.commit();
+
+    EXPECT_EQ(ring.high_water(), 5u);
+    ring.reset_high_water();
+    EXPECT_EQ(ring.high_water(), 0u);
+}
+
+// =============================================================================
+// 3. CONCURRENCY (one producer thread, one consumer thread)
+// =============================================================================
+
+TEST(SpscRing, ProducerConsumerThreadsSeeEveryItemInOrder) {
+    SpscRing<Item, 16> ring;
+    constexpr uint32_t COUNT = 200000;
+
+    std::thread producer([&] {
+        for (uint32_t i = 0; i < COUNT;) {
+            Item *slot = ring.acquire();
+            if (slot == nullptr) {
+                std::this_thread::yield();
+                continue;
+            }
+            slot->seq = i;
+            slot->raw[0] = static_cast<uint8_t>(i);
+            slot->raw[63] = static_cast<uint8_t>(i >> 8);
+            ring.commit();
+            ++i;
+        }
+    });
+
+    uint32_t expected = 0;
+    bool ordered = true;
+    while (expected < COUNT) {
+        Item *it = ring.front();
+        if (it == nullptr) {
+            std::this_thread::yield();
+            continue;
+        }
+        ordered &= it->seq == expected && it->raw[0] == static_cast<uint8_t>(expected) &&
+                   it->raw[63] == static_cast<uint8_t>(expected >> 8);
+        ring.pop();
+        ++expected;
+    }
+    producer.join();
+
+    EXPECT_TRUE(ordered);
+    EXPECT_TRUE(ring.empty());
+    EXPECT_LE(ring.high_water(), 16u);
+}
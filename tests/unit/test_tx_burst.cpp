@@ -0,0 +1,132 @@
+/// @file test_tx_burst.cpp
+/// @brief Unit tests for the RF task burst schedule (tx_burst.h).
+
+#include <gtest/gtest.h>
+
+#include "elero/elero_packet.h"
+#include "elero/tx_burst.h"
+
+using namespace esphome::elero;
+
+static constexpr uint8_t GAP = static_cast<uint8_t>(packet::button::INTER_PACKET_MS);
+
+// =============================================================================
+// 1. REPORT
+// =============================================================================
+
+TEST(TxBurstReport, SentOkCountsBits) {
+    EXPECT_EQ((TxBurstReport{3, 0b000}).sent_ok(), 0);
+    EXPECT_EQ((TxBurstReport{3, 0b101}).sent_ok(), 2);
+    EXPECT_EQ((TxBurstReport{8, 0xFF}).sent_ok(), 8);
+}
+
+TEST(TxBurstReport, AllOkNeedsEveryPacket) {
+    EXPECT_TRUE((TxBurstReport{3, 0b111}).all_ok());
+    EXPECT_FALSE((TxBurstReport{3, 0b011}).all_ok());
+    EXPECT_FALSE((TxBurstReport{0, 0}).all_ok());
+}
+
+// =============================================================================
+// 2. SCHEDULE
+// =============================================================================
+
+TEST(TxBurst, IdleByDefault) {
+    TxBurst b;
+    EXPECT_FALSE(b.active());
+    EXPECT_FALSE(b.finished());
+    EXPECT_FALSE(b.due(0));
+}
+
+TEST(TxBurst, FirstPacketDueImmediately) {
+    TxBurst b;
+    b.start(3, GAP, 1000);
+    EXPECT_TRUE(b.active());
+    EXPECT_TRUE(b.due(1000));
+}
+
+TEST(TxBurst, GapMeasuredFromEndOfPacket) {
+    TxBurst b;
+    b.start(3, GAP, 1000);
+    b.on_packet_done(true, 1004);  // 4 ms airtime
+    EXPECT_FALSE(b.due(1004 + GAP - 1));
+    EXPECT_TRUE(b.due(1004 + GAP));
+    EXPECT_EQ(b.next_ms(), 1004u + GAP);
+}
+
+TEST(TxBurst, RecordsPerPacketResults) {
+    TxBurst b;
+    b.start(3, GAP, 0);
+    b.on_packet_done(true, 5);
+    b.on_packet_done(false, 20);
+    EXPECT_TRUE(b.active());
+    EXPECT_FALSE(b.finished());
+    b.on_packet_done(true, 35);
+    EXPECT_FALSE(b.active());
+    EXPECT_TRUE(b.finished());
+    EXPECT_EQ(b.report().packets, 3);
+    EXPECT_EQ(b.report().ok_mask, 0b101);
+    EXPECT_FALSE(b.report().all_ok());
+}
+
+TEST(TxBurst, ExtraResultsIgnored) {
+    TxBurst b;
+    b.start(1, 0, 0);
+    b.on_packet_done(true, 5);
+    b.on_packet_done(false, 6);
+    EXPECT_EQ(b.report().ok_mask, 0b1);
+    EXPECT_TRUE(b.report().all_ok());
+}
+
+TEST(TxBurst, PacketCountClamped) {
+    TxBurst b;
+    b.start(0, GAP, 0);
+    EXPECT_EQ(b.report().packets, 1);
+    b.start(20, GAP, 0);
+    EXPECT_EQ(b.report().packets, TX_BURST_MAX_PACKETS);
+}
+
+TEST(TxBurst, ClearForgetsFinishedBurst) {
+    TxBurst b;
+    b.start(1, 0, 0);
+    b.on_packet_done(true, 5);
+    ASSERT_TRUE(b.finished());
+    b.clear();
+    EXPECT_FALSE(b.finished());
+    EXPECT_FALSE(b.active());
+}
+
+TEST(TxBurst, DueAcrossMillisWrap) {
+    TxBurst b;
+    b.start(2, GAP, 0xFFFFFFF0u);
+    b.on_packet_done(true, 0xFFFFFFFAu);
+    EXPECT_FALSE(b.due(0xFFFFFFFFu));
+    EXPECT_TRUE(b.due(0xFFFFFFFAu + GAP));  // wrapped past 0
+}
+
+TEST(TxBurst, AbortEndsBurstAfterSentPackets) {
+    TxBurst b;
+    b.start(3, GAP, 0);
+    b.on_packet_done(true, 5);
+    EXPECT_TRUE(b.abort());
+    EXPECT_TRUE(b.finished());
+    EXPECT_EQ(b.report().packets, 1);
+    EXPECT_TRUE(b.report().all_ok());
+}
+
+TEST(TxBurst, AbortBeforeFirstPacketIgnored) {
+    TxBurst b;
+    b.start(3, GAP, 0);
+    EXPECT_FALSE(b.abort());  // caller keeps the abort pending
+    EXPECT_TRUE(b.active());
+    EXPECT_EQ(b.report().packets, 3);
+}
+
+TEST(TxBurst, DeferPushesNextPacket) {
+    TxBurst b;
+    b.start(3, GAP, 1000);
+    b.defer(1005);
+    EXPECT_FALSE(b.due(1004));
+    EXPECT_TRUE(b.due(1005));
+    b.on_packet_done(true, 1010);
+    EXPECT_EQ(b.next_ms(), 1010u + GAP);  // Gap still counts from the end of the packet
+}
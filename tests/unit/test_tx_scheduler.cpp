@@ -0,0 +1,127 @@
+/// @file test_tx_scheduler.cpp
+/// @brief Unit tests for the hub-wide TX scheduler (priority classes, fairness, delay metrics).
+
+#include <gtest/gtest.h>
+
+#include "elero/tx_scheduler.h"
+
+using namespace esphome::elero;
+namespace pkt = esphome::elero::packet;
+
+using Sched = TxScheduler<48>;
+
+static TxRequest make_req(uint8_t cmd) {
+    TxRequest req;
+    req.cmd.payload[4] = cmd;
+    req.packets = 1;
+    return req;
+}
+
+TEST(TxScheduler, ClassOfCommand) {
+    EXPECT_EQ(tx_class_of(pkt::command::STOP, false), TxClass::SAFETY);
+    EXPECT_EQ(tx_class_of(pkt::command::UP, false), TxClass::USER);
+    EXPECT_EQ(tx_class_of(pkt::command::CHECK, false), TxClass::FOLLOW_UP);
+    EXPECT_EQ(tx_class_of(pkt::command::CHECK, true), TxClass::BACKGROUND);
+}
+
+TEST(TxScheduler, HigherClassOvertakesOlderRequests) {
+    Sched s;
+    s.submit(0, TxClass::BACKGROUND, make_req(pkt::command::CHECK), 100);
+    s.submit(1, TxClass::FOLLOW_UP, make_req(pkt::command::CHECK), 110);
+    s.submit(2, TxClass::USER, make_req(pkt::command::UP), 120);
+    s.submit(3, TxClass::SAFETY, make_req(pkt::command::STOP), 130);
+
+    uint8_t id = 0;
+    for (uint8_t expected : {3, 2, 1, 0}) {
+        ASSERT_TRUE(s.next(id));
+        EXPECT_EQ(id, expected);
+        s.on_posted(id, 140);
+        s.on_done(id);
+    }
+    EXPECT_FALSE(s.next(id));
+}
+
+TEST(TxScheduler, OldestFirstWithinClass) {
+    Sched s;
+    s.submit(5, TxClass::FOLLOW_UP, make_req(pkt::command::CHECK), 200);
+    s.submit(1, TxClass::FOLLOW_UP, make_req(pkt::command::CHECK), 300);
+    // Resubmitting keeps the original age
+    s.submit(5, TxClass::FOLLOW_UP, make_req(pkt::command::CHECK), 400);
+
+    uint8_t id = 0;
+    ASSERT_TRUE(s.next(id));
+    EXPECT_EQ(id, 5);
+}
+
+TEST(TxScheduler, LowestClassHoldsLowerClassesQueued) {
+    Sched s;
+    s.submit(0, TxClass::BACKGROUND, make_req(pkt::command::CHECK), 100);
+    s.submit(1, TxClass::FOLLOW_UP, make_req(pkt::command::CHECK), 110);
+
+    uint8_t id = 0;
+    EXPECT_FALSE(s.next(id, TxClass::USER));
+    ASSERT_TRUE(s.next(id, TxClass::FOLLOW_UP));
+    EXPECT_EQ(id, 1);
+    s.on_posted(id, 120);
+    EXPECT_FALSE(s.next(id, TxClass::FOLLOW_UP));
+    EXPECT_TRUE(s.queued(0));
+}
+
+TEST(TxScheduler, InFlightLimit) {
+    Sched s;
+    for (uint8_t i = 0; i < 4; ++i) s.submit(i, TxClass::USER, make_req(pkt::command::UP), i);
+
+    uint8_t id = 0;
+    for (size_t n = 0; n < tx_sched::MAX_IN_FLIGHT; ++n) {
+        ASSERT_TRUE(s.next(id));
+        s.on_posted(id, 10);
+    }
+    EXPECT_EQ(s.in_flight_count(), tx_sched::MAX_IN_FLIGHT);
+    EXPECT_FALSE(s.next(id));
+
+    s.on_done(0);
+    ASSERT_TRUE(s.next(id));
+    EXPECT_EQ(id, tx_sched::MAX_IN_FLIGHT);
+}
+
+TEST(TxScheduler, WithdrawOnlyUnsent) {
+    Sched s;
+    s.submit(0, TxClass::USER, make_req(pkt::command::UP), 0);
+    s.submit(1, TxClass::USER, make_req(pkt::command::DOWN), 0);
+    uint8_t id = 0;
+    ASSERT_TRUE(s.next(id));
+    s.on_posted(id, 5);
+
+    EXPECT_FALSE(s.withdraw(0));  // Already with the radio
+    EXPECT_TRUE(s.withdraw(1));
+    EXPECT_FALSE(s.queued(1));
+    EXPECT_EQ(s.queued_count(), 0u);
+
+    s.cancel(0);
+    EXPECT_FALSE(s.in_flight(0));
+}
+
+TEST(TxScheduler, PerClassDelayMetrics) {
+    Sched s;
+    s.update(0);
+    s.submit(0, TxClass::SAFETY, make_req(pkt::command::STOP), 1000);
+    s.submit(1, TxClass::BACKGROUND, make_req(pkt::command::CHECK), 1000);
+
+    uint8_t id = 0;
+    ASSERT_TRUE(s.next(id));
+    s.on_posted(id, 1010);
+    s.on_done(id);
+    ASSERT_TRUE(s.next(id));
+    s.on_posted(id, 1300);
+
+    EXPECT_EQ(s.sent_total(TxClass::SAFETY), 1u);
+    EXPECT_EQ(s.max_delay_ms(TxClass::SAFETY), 10u);
+    EXPECT_EQ(s.max_delay_ms(TxClass::BACKGROUND), 300u);
+    EXPECT_EQ(s.sent_total(TxClass::USER), 0u);
+
+    // Window average is published when the window closes
+    EXPECT_FLOAT_EQ(s.avg_delay_ms(TxClass::BACKGROUND), 0.0f);
+    s.update(tx_sched::DELAY_WINDOW_MS);
+    EXPECT_FLOAT_EQ(s.avg_delay_ms(TxClass::BACKGROUND), 300.0f);
+    EXPECT_FLOAT_EQ(s.avg_delay_ms(TxClass::SAFETY), 10.0f);
+}
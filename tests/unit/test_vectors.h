@@ -119,6 +119,102 @@ constexpr PacketVector VEC_INVALID_EMPTY = {
   .reject_reason = "too_short",
 };
 
+// ─── Valid Packet Vectors ───────────────────────────────────────────────────
+//
+// Encoder output (build_tx_packet / build_button_packet) with RSSI and
+// LQI|CRC_OK appended as the CC1101 would. Used for parse checks and as the
+// input set for bench_packet.
+
+// 0x6A targeted UP, counter 0x12, remote 0xF0D008 → blind 0xA831E5
+constexpr uint8_t RAW_COMMAND_UP[] = {
+  0x1D, 0x12, 0x6A, 0x00, 0x0A, 0x01, 0x05,  // header
+  0xF0, 0xD0, 0x08,  // src (remote)
+  0xF0, 0xD0, 0x08,  // bwd
+  0xF0, 0xD0, 0x08,  // fwd
+  0x01,              // num_dests
+  0xA8, 0x31, 0xE5,  // dst (blind)
+  0x00, 0x04,        // payload header
+  0x81, 0x3B, 0x36, 0x70, 0x71, 0x07, 0xD5, 0x0D,  // encrypted payload
+  0xD8, 0xAE,        // RSSI, LQI|CRC_OK
+};
+
+constexpr PacketVector VEC_COMMAND_UP = {
+  .name = "CommandUp",
+  .description = "0x6A targeted UP command",
+  .raw = RAW_COMMAND_UP,
+  .raw_len = sizeof(RAW_COMMAND_UP),
+  .exp_type = packet::msg_type::COMMAND,
+  .exp_channel = 5,
+  .exp_src_addr = 0xf0d008,
+  .exp_dst_addr = 0xa831e5,
+  .exp_command = packet::command::UP,
+  .exp_state = 0,
+  .expect_valid = true,
+  .reject_reason = nullptr,
+};
+
+// 0xCA status TOP, counter 0x34, blind 0xA831E5 → remote 0xF0D008
+constexpr uint8_t RAW_STATUS_TOP[] = {
+  0x1D, 0x34, 0xCA, 0x00, 0x0A, 0x01, 0x05,  // header
+  0xA8, 0x31, 0xE5,  // src (blind)
+  0xA8, 0x31, 0xE5,  // bwd
+  0xA8, 0x31, 0xE5,  // fwd
+  0x01,              // num_dests
+  0xF0, 0xD0, 0x08,  // dst (remote)
+  0x00, 0x04,        // payload header
+  0x28, 0x38, 0xC9, 0x73, 0xEF, 0x08, 0x22, 0xEF,  // encrypted payload
+  0xC4, 0xB0,        // RSSI, LQI|CRC_OK
+};
+
+constexpr PacketVector VEC_STATUS_TOP = {
+  .name = "StatusTop",
+  .description = "0xCA status, blind at top position",
+  .raw = RAW_STATUS_TOP,
+  .raw_len = sizeof(RAW_STATUS_TOP),
+  .exp_type = packet::msg_type::STATUS,
+  .exp_channel = 5,
+  .exp_src_addr = 0xa831e5,
+  .exp_dst_addr = 0xf0d008,
+  .exp_command = 0,
+  .exp_state = packet::state::TOP,
+  .expect_valid = true,
+  .reject_reason = nullptr,
+};
+
+// 0x44 button DOWN on channel 5, counter 0x56
+constexpr uint8_t RAW_BUTTON_DOWN[] = {
+  0x1B, 0x56, 0x44, 0x10, 0x00, 0x01, 0x05,  // header
+  0xF0, 0xD0, 0x08,  // src (remote)
+  0xF0, 0xD0, 0x08,  // bwd
+  0xF0, 0xD0, 0x08,  // fwd
+  0x01,              // num_dests
+  0x05, 0x00, 0x03,  // channel dest, 0x00, 0x03
+  0x24, 0x3D, 0x4E, 0x7B, 0xEC, 0x0D, 0x24, 0xD7,  // encrypted payload
+  0xE0, 0xA5,        // RSSI, LQI|CRC_OK
+};
+
+constexpr PacketVector VEC_BUTTON_DOWN = {
+  .name = "ButtonDown",
+  .description = "0x44 button DOWN broadcast on channel 5",
+  .raw = RAW_BUTTON_DOWN,
+  .raw_len = sizeof(RAW_BUTTON_DOWN),
+  .exp_type = packet::msg_type::BUTTON,
+  .exp_channel = 5,
+  .exp_src_addr = 0xf0d008,
+  .exp_dst_addr = 0x05,
+  .exp_command = packet::command::DOWN,
+  .exp_state = 0,
+  .expect_valid = true,
+  .reject_reason = nullptr,
+};
+
+// ─── All Vectors ────────────────────────────────────────────────────────────
+
+constexpr const PacketVector *ALL_VECTORS[] = {
+  &VEC_INVALID_TOO_LONG, &VEC_INVALID_TOO_MANY_DESTS, &VEC_INVALID_TOO_SHORT, &VEC_INVALID_EMPTY,
+  &VEC_COMMAND_UP, &VEC_STATUS_TOP, &VEC_BUTTON_DOWN,
+};
+
 // ─── Placeholder for Real RF Captures ───────────────────────────────────────
 //
 // Add real RF packet captures here. Example format: